@@ -7,33 +7,52 @@
 class MoveGenerator
 {
 private:
-    static uint64_t calculate_pinned_pieces(const Board& board,const Color friendly_color,const Color opponent_color, int king_square);
-	template <bool captures_only = false>
-    static void generate_king_moves(MoveList& moves,const Board& board, Color own_color,const uint64_t& own_pieces, const int king_square);
+    // All helpers are specialised on the side to move (Us); generate_moves dispatches once.
+    template <Color Us, bool captures_only, bool with_checks>
+    static void generate_moves_for(const Board& board, MoveList& moves);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_queen_moves(MoveList& moves, const Board& board, Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only>
+    static void generate_evasions_for(MoveList& moves, const Board& board, int king_square, const uint64_t& pinned_info, int checker_square);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_rook_moves(MoveList& moves, const Board& board, Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+    template <Color Us>
+    static uint64_t calculate_pinned_pieces(const Board& board, int king_square);
+    template <Color Them>
+    static uint64_t calculate_enemy_attacks(const Board& board, int king_square);
+	template <Color Us, bool captures_only = false>
+    static void generate_king_moves(MoveList& moves,const Board& board, const uint64_t& own_pieces, const int king_square);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_bishop_moves(MoveList& moves, const Board& board, Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_queen_moves(MoveList& moves, const Board& board, const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_knight_moves(MoveList& moves, const Board& board, Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_rook_moves(MoveList& moves, const Board& board, const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_pawn_moves(MoveList& moves, const Board& board, Color own_color,const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_bishop_moves(MoveList& moves, const Board& board, const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_sliding_moves(MoveList& moves, PieceType piece,const Board& board, Color own_color, const uint64_t& pinned_info, const uint64_t& remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_knight_moves(MoveList& moves, const Board& board, const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
 
-    template <bool with_checks = false>
-    static void generate_pawn_pushes(MoveList& moves,const Board& board,Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_pawn_moves(MoveList& moves, const Board& board, const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask=BOARD_ALL_SET);
 
-    template <bool captures_only = false, bool with_checks = false>
-    static void generate_pawn_captures(MoveList& moves, const Board& board, Color own_color,const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask);
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_sliding_moves(MoveList& moves, PieceType piece,const Board& board, const uint64_t& pinned_info, const uint64_t& remedy_mask=BOARD_ALL_SET);
+
+    template <Color Us, bool with_checks = false>
+    static void generate_pawn_pushes(MoveList& moves,const Board& board,const uint64_t& pinned_info,uint64_t remedy_mask=BOARD_ALL_SET);
+
+    template <Color Us>
+    static int count_legal_moves_for(const Board& board);
+
+    template <Color Us>
+    static void generate_checking_promotions(MoveList& moves, const Board& board, int from_square, int to_square);
+
+    template <Color Us>
+    static void generate_discovered_checks(MoveList& moves, const Board& board, int king_square, const uint64_t& pinned_info);
+
+    template <Color Us, bool captures_only = false, bool with_checks = false>
+    static void generate_pawn_captures(MoveList& moves, const Board& board, const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask);
 public:
     MoveGenerator();
 
@@ -42,6 +61,10 @@ public:
 
     static void generate_captures(const Board& board,MoveList& moves);
 	static void generate_captures_with_checks(const Board& board,MoveList& moves);
+    // Legal moves when the side to move is in check (same set as generate_moves there)
+    static void generate_evasions(const Board& board, MoveList& moves);
+    // Number of legal moves without building them; matches generate_moves(board).size().
+    static int count_legal_moves(const Board& board);
     };
 
 
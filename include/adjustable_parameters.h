@@ -90,8 +90,8 @@ constexpr int UNDEFENDED_PIECE_PENALTY_MG[5] = { 0, -15, -15, -21, -36 }; // use
 constexpr int UNDEFENDED_PIECE_PENALTY_EG[5] = { 0, -3, -3, -6, -10 };
 constexpr int HANGING_PIECE_PENALTY_MG[5] = { 0, -28, -28, -43, -70 }; // same as above
 constexpr int HANGING_PIECE_PENALTY_EG[5] = { 0, -7, -7, -10, -18 };
-const int PIECE_VALUES_MG[6] = { 100, 340, 280, 334, 782, 20000 };
-const int PIECE_VALUES_EG[6] = { 100, 255, 242, 416, 889, 20000 };
+constexpr int PIECE_VALUES_MG[6] = { 100, 340, 280, 334, 782, 20000 };
+constexpr int PIECE_VALUES_EG[6] = { 100, 255, 242, 416, 889, 20000 };
 
 // --- NEU: Mobility Bonuses ---
 constexpr int MOBILITY_BONUS_MG[6] = { 0, 0, 5, 2, 1, 0 }; // Pawn, Knight, Bishop, Rook, Queen, King
@@ -121,6 +121,9 @@ constexpr int QUEEN_ATTACK_VALUE = 80;
 const int FUTILITY_MARGIN_D1 = 200;
 const int FUTILITY_MARGIN_D2 = 400;
 const int DELTA_MARGIN = 200;
+// Heuristic lazy-eval cutoff, not a bound: over ~300k perft positions the non-lazy terms moved the
+// score by up to 215 cp, but by at most 124 cp in 99.9% of them
+constexpr int LAZY_EVAL_MARGIN = 200;
 constexpr int MAX_QUIET_PLY = 7;
 
 // --- NEU: Late Move Reduction (LMR) ---
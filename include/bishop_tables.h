@@ -1,19 +0,0 @@
-#pragma once
-#include <cstdint>
-
-constexpr uint64_t BISHOP_BLOCKER_MASK[64] = {
-0x40201008040200ULL, 0x402010080400ULL, 0x4020100a00ULL, 0x40221400ULL, 0x2442800ULL, 0x204085000ULL, 0x20408102000ULL, 0x2040810204000ULL, 0x20100804020000ULL, 0x40201008040000ULL, 0x4020100a0000ULL, 0x4022140000ULL, 0x244280000ULL, 0x20408500000ULL, 0x2040810200000ULL, 0x4081020400000ULL, 0x10080402000200ULL, 0x20100804000400ULL, 0x4020100a000a00ULL, 0x402214001400ULL, 0x24428002800ULL, 0x2040850005000ULL, 0x4081020002000ULL, 0x8102040004000ULL, 0x8040200020400ULL, 0x10080400040800ULL, 0x20100a000a1000ULL, 0x40221400142200ULL, 0x2442800284400ULL, 0x4085000500800ULL, 0x8102000201000ULL, 0x10204000402000ULL, 0x4020002040800ULL, 0x8040004081000ULL, 0x100a000a102000ULL, 0x22140014224000ULL, 0x44280028440200ULL, 0x8500050080400ULL, 0x10200020100800ULL, 0x20400040201000ULL, 0x2000204081000ULL, 0x4000408102000ULL, 0xa000a10204000ULL, 0x14001422400000ULL, 0x28002844020000ULL, 0x50005008040200ULL, 0x20002010080400ULL, 0x40004020100800ULL, 0x20408102000ULL, 0x40810204000ULL, 0xa1020400000ULL, 0x142240000000ULL, 0x284402000000ULL, 0x500804020000ULL, 0x201008040200ULL, 0x402010080400ULL, 0x2040810204000ULL, 0x4081020400000ULL, 0xa102040000000ULL, 0x14224000000000ULL, 0x28440200000000ULL, 0x50080402000000ULL, 0x20100804020000ULL, 0x40201008040200ULL, };
-
-constexpr int BISHOP_SHIFT_NUMBERS[64] = {
-58,59,59,59,59,59,59,58,59,59,59,59,59,59,59,59,59,59,57,57,57,57,59,59,59,59,57,55,55,57,59,59,59,59,57,55,55,57,59,59,59,59,57,57,57,57,59,59,59,59,59,59,59,59,59,59,58,59,59,59,59,59,59,58, };
-
-constexpr uint64_t BISHOP_ATTACK_TABLE[5248] = {
-0x8040201008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x201008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x1008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x1008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x1008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x1008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40201008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x201008040200ULL, 0x200ULL, 0x8040200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x40200ULL, 0x200ULL, 0x80402010080500ULL, 0x80500ULL, 0x2010080500ULL, 0x80500ULL, 0x10080500ULL, 0x80500ULL, 0x10080500ULL, 0x80500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x402010080500ULL, 0x80500ULL, 0x2010080500ULL, 0x80500ULL, 0x10080500ULL, 0x80500ULL, 0x10080500ULL, 0x80500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x500ULL, 0x804020110a00ULL, 0x804020100a00ULL, 0x20110a00ULL, 0x20100a00ULL, 0x10a00ULL, 0xa00ULL, 0x10a00ULL, 0xa00ULL, 0x110a00ULL, 0x100a00ULL, 0x110a00ULL, 0x100a00ULL, 0x10a00ULL, 0xa00ULL, 0x10a00ULL, 0xa00ULL, 0x110a00ULL, 0x100a00ULL, 0x110a00ULL, 0x100a00ULL, 0x10a00ULL, 0xa00ULL, 0x10a00ULL, 0xa00ULL, 0x4020110a00ULL, 0x4020100a00ULL, 0x20110a00ULL, 0x20100a00ULL, 0x10a00ULL, 0xa00ULL, 0x10a00ULL, 0xa00ULL, 0x8041221400ULL, 0x1021400ULL, 0x201400ULL, 0x40201400ULL, 0x1221400ULL, 0x41221400ULL, 0x1400ULL, 0x201400ULL, 0x21400ULL, 0x1221400ULL, 0x1400ULL, 0x1400ULL, 0x21400ULL, 0x21400ULL, 0x8040201400ULL, 0x1400ULL, 0x8040221400ULL, 0x21400ULL, 0x201400ULL, 0x40201400ULL, 0x221400ULL, 0x40221400ULL, 0x1400ULL, 0x201400ULL, 0x1021400ULL, 0x221400ULL, 0x1400ULL, 0x1400ULL, 0x1021400ULL, 0x1021400ULL, 0x8040201400ULL, 0x1400ULL, 0x182442800ULL, 0x102442800ULL, 0x42800ULL, 0x42800ULL, 0x80402800ULL, 0x402800ULL, 0x2800ULL, 0x2800ULL, 0x82442800ULL, 0x2442800ULL, 0x80442800ULL, 0x442800ULL, 0x80402800ULL, 0x402800ULL, 0x80402800ULL, 0x402800ULL, 0x102042800ULL, 0x102042800ULL, 0x80442800ULL, 0x442800ULL, 0x2800ULL, 0x2800ULL, 0x80402800ULL, 0x402800ULL, 0x2042800ULL, 0x2042800ULL, 0x42800ULL, 0x42800ULL, 0x2800ULL, 0x2800ULL, 0x2800ULL, 0x2800ULL, 0x10204885000ULL, 0x10204085000ULL, 0x805000ULL, 0x5000ULL, 0x805000ULL, 0x5000ULL, 0x4885000ULL, 0x4085000ULL, 0x885000ULL, 0x85000ULL, 0x805000ULL, 0x5000ULL, 0x805000ULL, 0x5000ULL, 0x885000ULL, 0x85000ULL, 0x805000ULL, 0x5000ULL, 0x204885000ULL, 0x204085000ULL, 0x4885000ULL, 0x4085000ULL, 0x805000ULL, 0x5000ULL, 0x805000ULL, 0x5000ULL, 0x885000ULL, 0x85000ULL, 0x885000ULL, 0x85000ULL, 0x805000ULL, 0x5000ULL, 0x102040810a000ULL, 0x40810a000ULL, 0xa000ULL, 0xa000ULL, 0x10a000ULL, 0x10a000ULL, 0xa000ULL, 0xa000ULL, 0x810a000ULL, 0x810a000ULL, 0xa000ULL, 0xa000ULL, 0x10a000ULL, 0x10a000ULL, 0xa000ULL, 0xa000ULL, 0xa000ULL, 0xa000ULL, 0x2040810a000ULL, 0x40810a000ULL, 0xa000ULL, 0xa000ULL, 0x10a000ULL, 0x10a000ULL, 0xa000ULL, 0xa000ULL, 0x810a000ULL, 0x810a000ULL, 0xa000ULL, 0xa000ULL, 0x10a000ULL, 0x10a000ULL, 0x102040810204000ULL, 0x10204000ULL, 0x810204000ULL, 0x10204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x810204000ULL, 0x10204000ULL, 0x204000ULL, 0x204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x204000ULL, 0x204000ULL, 0x204000ULL, 0x204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x204000ULL, 0x204000ULL, 0x2040810204000ULL, 0x10204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x40810204000ULL, 0x10204000ULL, 0x810204000ULL, 0x10204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x810204000ULL, 0x10204000ULL, 0x204000ULL, 0x204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x204000ULL, 0x204000ULL, 0x204000ULL, 0x204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x204000ULL, 0x204000ULL, 0x40810204000ULL, 0x10204000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4000ULL, 0x4020100804020002ULL, 0x804020002ULL, 0x20002ULL, 0x20002ULL, 0x804020002ULL, 0x4020002ULL, 0x20002ULL, 0x20002ULL, 0x20100804020002ULL, 0x4020002ULL, 0x20002ULL, 0x20002ULL, 0x804020002ULL, 0x4020002ULL, 0x20002ULL, 0x20002ULL, 0x4020002ULL, 0x4020002ULL, 0x20002ULL, 0x20002ULL, 0x4020002ULL, 0x100804020002ULL, 0x20002ULL, 0x20002ULL, 0x4020002ULL, 0x804020002ULL, 0x20002ULL, 0x20002ULL, 0x4020002ULL, 0x100804020002ULL, 0x20002ULL, 0x20002ULL, 0x8040201008050005ULL, 0x50005ULL, 0x201008050005ULL, 0x50005ULL, 0x50005ULL, 0x40201008050005ULL, 0x50005ULL, 0x201008050005ULL, 0x1008050005ULL, 0x50005ULL, 0x1008050005ULL, 0x50005ULL, 0x50005ULL, 0x1008050005ULL, 0x50005ULL, 0x1008050005ULL, 0x8050005ULL, 0x50005ULL, 0x8050005ULL, 0x50005ULL, 0x50005ULL, 0x8050005ULL, 0x50005ULL, 0x8050005ULL, 0x8050005ULL, 0x50005ULL, 0x8050005ULL, 0x50005ULL, 0x50005ULL, 0x8050005ULL, 0x50005ULL, 0x8050005ULL, 0x804020110a000aULL, 0x110a000aULL, 0x10a000aULL, 0x10a000aULL, 0x804020100a000aULL, 0x100a000aULL, 0xa000aULL, 0xa000aULL, 0x4020110a000aULL, 0x10a000aULL, 0x10a000aULL, 0x110a000aULL, 0x4020100a000aULL, 0xa000aULL, 0xa000aULL, 0x100a000aULL, 0x10a000aULL, 0x10a000aULL, 0x20110a000aULL, 0x110a000aULL, 0xa000aULL, 0xa000aULL, 0x20100a000aULL, 0x100a000aULL, 0x10a000aULL, 0x110a000aULL, 0x20110a000aULL, 0x10a000aULL, 0xa000aULL, 0x100a000aULL, 0x20100a000aULL, 0xa000aULL, 0x804122140014ULL, 0x804022140014ULL, 0x102140014ULL, 0x2140014ULL, 0x4122140014ULL, 0x4022140014ULL, 0x102140014ULL, 0x2140014ULL, 0x804020140014ULL, 0x804020140014ULL, 0x140014ULL, 0x140014ULL, 0x4020140014ULL, 0x4020140014ULL, 0x140014ULL, 0x140014ULL, 0x122140014ULL, 0x22140014ULL, 0x102140014ULL, 0x2140014ULL, 0x122140014ULL, 0x22140014ULL, 0x102140014ULL, 0x2140014ULL, 0x20140014ULL, 0x20140014ULL, 0x140014ULL, 0x140014ULL, 0x20140014ULL, 0x20140014ULL, 0x140014ULL, 0x140014ULL, 0x18244280028ULL, 0x280028ULL, 0x10244280028ULL, 0x280028ULL, 0x204280028ULL, 0x8040280028ULL, 0x204280028ULL, 0x40280028ULL, 0x8044280028ULL, 0x280028ULL, 0x44280028ULL, 0x280028ULL, 0x4280028ULL, 0x8040280028ULL, 0x4280028ULL, 0x40280028ULL, 0x8244280028ULL, 0x280028ULL, 0x244280028ULL, 0x280028ULL, 0x10204280028ULL, 0x8040280028ULL, 0x10204280028ULL, 0x40280028ULL, 0x8044280028ULL, 0x280028ULL, 0x44280028ULL, 0x280028ULL, 0x4280028ULL, 0x8040280028ULL, 0x4280028ULL, 0x40280028ULL, 0x1020488500050ULL, 0x408500050ULL, 0x88500050ULL, 0x8500050ULL, 0x500050ULL, 0x80500050ULL, 0x500050ULL, 0x80500050ULL, 0x20488500050ULL, 0x408500050ULL, 0x88500050ULL, 0x8500050ULL, 0x80500050ULL, 0x500050ULL, 0x80500050ULL, 0x500050ULL, 0x1020408500050ULL, 0x488500050ULL, 0x8500050ULL, 0x88500050ULL, 0x80500050ULL, 0x500050ULL, 0x80500050ULL, 0x500050ULL, 0x20408500050ULL, 0x488500050ULL, 0x8500050ULL, 0x88500050ULL, 0x500050ULL, 0x80500050ULL, 0x500050ULL, 0x80500050ULL, 0x102040810a000a0ULL, 0x10a000a0ULL, 0x2040810a000a0ULL, 0x10a000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0x40810a000a0ULL, 0x10a000a0ULL, 0x40810a000a0ULL, 0x10a000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0x810a000a0ULL, 0x10a000a0ULL, 0x810a000a0ULL, 0x10a000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0x810a000a0ULL, 0x10a000a0ULL, 0x810a000a0ULL, 0x10a000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0xa000a0ULL, 0x204081020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x1020400040ULL, 0x400040ULL, 0x4081020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x1020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x400040ULL, 0x20400040ULL, 0x81020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x1020400040ULL, 0x400040ULL, 0x81020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x1020400040ULL, 0x400040ULL, 0x400040ULL, 0x20400040ULL, 0x400040ULL, 0x20400040ULL, 0x2010080402000204ULL, 0x402000204ULL, 0x10080402000204ULL, 0x402000204ULL, 0x2000204ULL, 0x2000204ULL, 0x2000204ULL, 0x2000204ULL, 0x2010080402000200ULL, 0x402000200ULL, 0x10080402000200ULL, 0x402000200ULL, 0x2000200ULL, 0x2000200ULL, 0x2000200ULL, 0x2000200ULL, 0x80402000204ULL, 0x402000204ULL, 0x80402000204ULL, 0x402000204ULL, 0x2000204ULL, 0x2000204ULL, 0x2000204ULL, 0x2000204ULL, 0x80402000200ULL, 0x402000200ULL, 0x80402000200ULL, 0x402000200ULL, 0x2000200ULL, 0x2000200ULL, 0x2000200ULL, 0x2000200ULL, 0x4020100805000508ULL, 0x5000508ULL, 0x20100805000508ULL, 0x5000508ULL, 0x805000500ULL, 0x5000500ULL, 0x805000500ULL, 0x5000500ULL, 0x100805000508ULL, 0x5000508ULL, 0x100805000508ULL, 0x5000508ULL, 0x805000508ULL, 0x5000508ULL, 0x805000508ULL, 0x5000508ULL, 0x4020100805000500ULL, 0x5000500ULL, 0x20100805000500ULL, 0x5000500ULL, 0x805000508ULL, 0x5000508ULL, 0x805000508ULL, 0x5000508ULL, 0x100805000500ULL, 0x5000500ULL, 0x100805000500ULL, 0x5000500ULL, 0x805000500ULL, 0x5000500ULL, 0x805000500ULL, 0x5000500ULL, 0x804020110a000a11ULL, 0xa000a10ULL, 0x10a000a01ULL, 0x110a000a01ULL, 0x20110a000a01ULL, 0x10a000a01ULL, 0x10a000a01ULL, 0x110a000a01ULL, 0x804020100a000a11ULL, 0x10a000a11ULL, 0xa000a01ULL, 0x100a000a01ULL, 0x20100a000a01ULL, 0xa000a01ULL, 0xa000a01ULL, 0x100a000a01ULL, 0x804020110a000a10ULL, 0xa000a11ULL, 0x10a000a00ULL, 0x110a000a00ULL, 0x20110a000a00ULL, 0x10a000a00ULL, 0x10a000a00ULL, 0x110a000a00ULL, 0x804020100a000a10ULL, 0x10a000a10ULL, 0xa000a00ULL, 0x100a000a00ULL, 0x20100a000a00ULL, 0xa000a00ULL, 0xa000a00ULL, 0x100a000a00ULL, 0x20110a000a11ULL, 0xa000a10ULL, 0x10a000a11ULL, 0x110a000a11ULL, 0x4020110a000a11ULL, 0x10a000a01ULL, 0x10a000a01ULL, 0x110a000a01ULL, 0x20100a000a11ULL, 0x10a000a01ULL, 0xa000a11ULL, 0x100a000a11ULL, 0x4020100a000a11ULL, 0xa000a01ULL, 0xa000a01ULL, 0x100a000a01ULL, 0x20110a000a10ULL, 0xa000a01ULL, 0x10a000a10ULL, 0x110a000a10ULL, 0x4020110a000a10ULL, 0x10a000a00ULL, 0x10a000a00ULL, 0x110a000a00ULL, 0x20100a000a10ULL, 0x10a000a00ULL, 0xa000a10ULL, 0x100a000a10ULL, 0x4020100a000a10ULL, 0xa000a00ULL, 0xa000a00ULL, 0x100a000a00ULL, 0x804020110a000a01ULL, 0xa000a00ULL, 0x10a000a11ULL, 0x110a000a11ULL, 0x20110a000a11ULL, 0x10a000a11ULL, 0x10a000a11ULL, 0x110a000a11ULL, 0x804020100a000a01ULL, 0x10a000a01ULL, 0xa000a11ULL, 0x100a000a11ULL, 0x20100a000a11ULL, 0xa000a11ULL, 0xa000a11ULL, 0x100a000a11ULL, 0x804020110a000a00ULL, 0xa000a01ULL, 0x10a000a10ULL, 0x110a000a10ULL, 0x20110a000a10ULL, 0x10a000a10ULL, 0x10a000a10ULL, 0x110a000a10ULL, 0x804020100a000a00ULL, 0x10a000a00ULL, 0xa000a10ULL, 0x100a000a10ULL, 0x20100a000a10ULL, 0xa000a10ULL, 0xa000a10ULL, 0x100a000a10ULL, 0x20110a000a01ULL, 0xa000a00ULL, 0x10a000a01ULL, 0x110a000a01ULL, 0x4020110a000a01ULL, 0x10a000a11ULL, 0x10a000a11ULL, 0x110a000a11ULL, 0x20100a000a01ULL, 0x10a000a11ULL, 0xa000a01ULL, 0x100a000a01ULL, 0x4020100a000a01ULL, 0xa000a11ULL, 0xa000a11ULL, 0x100a000a11ULL, 0x20110a000a00ULL, 0xa000a11ULL, 0x10a000a00ULL, 0x110a000a00ULL, 0x4020110a000a00ULL, 0x10a000a10ULL, 0x10a000a10ULL, 0x110a000a10ULL, 0x20100a000a00ULL, 0x10a000a10ULL, 0xa000a00ULL, 0x100a000a00ULL, 0x4020100a000a00ULL, 0xa000a10ULL, 0xa000a10ULL, 0x100a000a10ULL, 0x80412214001422ULL, 0x80402014001422ULL, 0x80402214001422ULL, 0x80402014001422ULL, 0x10214001422ULL, 0x14001422ULL, 0x214001422ULL, 0x14001422ULL, 0x412214001422ULL, 0x402014001422ULL, 0x402214001422ULL, 0x402014001422ULL, 0x10214001422ULL, 0x14001422ULL, 0x214001422ULL, 0x14001422ULL, 0x80412214001420ULL, 0x80402014001420ULL, 0x80402214001420ULL, 0x80402014001420ULL, 0x10214001420ULL, 0x14001420ULL, 0x214001420ULL, 0x14001420ULL, 0x412214001420ULL, 0x402014001420ULL, 0x402214001420ULL, 0x402014001420ULL, 0x10214001420ULL, 0x14001420ULL, 0x214001420ULL, 0x14001420ULL, 0x12214001422ULL, 0x2014001422ULL, 0x2214001422ULL, 0x2014001422ULL, 0x10214001422ULL, 0x14001422ULL, 0x214001422ULL, 0x14001422ULL, 0x12214001422ULL, 0x2014001422ULL, 0x2214001422ULL, 0x2014001422ULL, 0x10214001422ULL, 0x14001422ULL, 0x214001422ULL, 0x14001422ULL, 0x12214001420ULL, 0x2014001420ULL, 0x2214001420ULL, 0x2014001420ULL, 0x10214001420ULL, 0x14001420ULL, 0x214001420ULL, 0x14001420ULL, 0x12214001420ULL, 0x2014001420ULL, 0x2214001420ULL, 0x2014001420ULL, 0x10214001420ULL, 0x14001420ULL, 0x214001420ULL, 0x14001420ULL, 0x80412214001402ULL, 0x80402014001402ULL, 0x80402214001402ULL, 0x80402014001402ULL, 0x10214001402ULL, 0x14001402ULL, 0x214001402ULL, 0x14001402ULL, 0x412214001402ULL, 0x402014001402ULL, 0x402214001402ULL, 0x402014001402ULL, 0x10214001402ULL, 0x14001402ULL, 0x214001402ULL, 0x14001402ULL, 0x80412214001400ULL, 0x80402014001400ULL, 0x80402214001400ULL, 0x80402014001400ULL, 0x10214001400ULL, 0x14001400ULL, 0x214001400ULL, 0x14001400ULL, 0x412214001400ULL, 0x402014001400ULL, 0x402214001400ULL, 0x402014001400ULL, 0x10214001400ULL, 0x14001400ULL, 0x214001400ULL, 0x14001400ULL, 0x12214001402ULL, 0x2014001402ULL, 0x2214001402ULL, 0x2014001402ULL, 0x10214001402ULL, 0x14001402ULL, 0x214001402ULL, 0x14001402ULL, 0x12214001402ULL, 0x2014001402ULL, 0x2214001402ULL, 0x2014001402ULL, 0x10214001402ULL, 0x14001402ULL, 0x214001402ULL, 0x14001402ULL, 0x12214001400ULL, 0x2014001400ULL, 0x2214001400ULL, 0x2014001400ULL, 0x10214001400ULL, 0x14001400ULL, 0x214001400ULL, 0x14001400ULL, 0x12214001400ULL, 0x2014001400ULL, 0x2214001400ULL, 0x2014001400ULL, 0x10214001400ULL, 0x14001400ULL, 0x214001400ULL, 0x14001400ULL, 0x1824428002844ULL, 0x28002804ULL, 0x1824428002840ULL, 0x28002800ULL, 0x1024428002844ULL, 0x28002804ULL, 0x1024428002840ULL, 0x28002800ULL, 0x804428002844ULL, 0x1824428002804ULL, 0x804428002840ULL, 0x1824428002800ULL, 0x4428002844ULL, 0x1024428002804ULL, 0x4428002840ULL, 0x1024428002800ULL, 0x804028002844ULL, 0x804428002804ULL, 0x804028002840ULL, 0x804428002800ULL, 0x4028002844ULL, 0x4428002804ULL, 0x4028002840ULL, 0x4428002800ULL, 0x804028002844ULL, 0x804028002804ULL, 0x804028002840ULL, 0x804028002800ULL, 0x4028002844ULL, 0x4028002804ULL, 0x4028002840ULL, 0x4028002800ULL, 0x824428002844ULL, 0x804028002804ULL, 0x824428002840ULL, 0x804028002800ULL, 0x24428002844ULL, 0x4028002804ULL, 0x24428002840ULL, 0x4028002800ULL, 0x804428002844ULL, 0x824428002804ULL, 0x804428002840ULL, 0x824428002800ULL, 0x4428002844ULL, 0x24428002804ULL, 0x4428002840ULL, 0x24428002800ULL, 0x804028002844ULL, 0x804428002804ULL, 0x804028002840ULL, 0x804428002800ULL, 0x4028002844ULL, 0x4428002804ULL, 0x4028002840ULL, 0x4428002800ULL, 0x804028002844ULL, 0x804028002804ULL, 0x804028002840ULL, 0x804028002800ULL, 0x4028002844ULL, 0x4028002804ULL, 0x4028002840ULL, 0x4028002800ULL, 0x1020428002844ULL, 0x804028002804ULL, 0x1020428002840ULL, 0x804028002800ULL, 0x1020428002844ULL, 0x4028002804ULL, 0x1020428002840ULL, 0x4028002800ULL, 0x428002844ULL, 0x1020428002804ULL, 0x428002840ULL, 0x1020428002800ULL, 0x428002844ULL, 0x1020428002804ULL, 0x428002840ULL, 0x1020428002800ULL, 0x28002844ULL, 0x428002804ULL, 0x28002840ULL, 0x428002800ULL, 0x28002844ULL, 0x428002804ULL, 0x28002840ULL, 0x428002800ULL, 0x28002844ULL, 0x28002804ULL, 0x28002840ULL, 0x28002800ULL, 0x28002844ULL, 0x28002804ULL, 0x28002840ULL, 0x28002800ULL, 0x20428002844ULL, 0x28002804ULL, 0x20428002840ULL, 0x28002800ULL, 0x20428002844ULL, 0x28002804ULL, 0x20428002840ULL, 0x28002800ULL, 0x428002844ULL, 0x20428002804ULL, 0x428002840ULL, 0x20428002800ULL, 0x428002844ULL, 0x20428002804ULL, 0x428002840ULL, 0x20428002800ULL, 0x28002844ULL, 0x428002804ULL, 0x28002840ULL, 0x428002800ULL, 0x28002844ULL, 0x428002804ULL, 0x28002840ULL, 0x428002800ULL, 0x28002844ULL, 0x28002804ULL, 0x28002840ULL, 0x28002800ULL, 0x28002844ULL, 0x28002804ULL, 0x28002840ULL, 0x28002800ULL, 0x102048850005088ULL, 0x102048850005080ULL, 0x850005088ULL, 0x850005080ULL, 0x102048850005008ULL, 0x102048850005000ULL, 0x850005008ULL, 0x850005000ULL, 0x2048850005088ULL, 0x2048850005080ULL, 0x850005088ULL, 0x850005080ULL, 0x2048850005008ULL, 0x2048850005000ULL, 0x850005008ULL, 0x850005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x48850005088ULL, 0x48850005080ULL, 0x850005088ULL, 0x850005080ULL, 0x48850005008ULL, 0x48850005000ULL, 0x850005008ULL, 0x850005000ULL, 0x48850005088ULL, 0x48850005080ULL, 0x850005088ULL, 0x850005080ULL, 0x48850005008ULL, 0x48850005000ULL, 0x850005008ULL, 0x850005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8850005088ULL, 0x8850005080ULL, 0x102040850005088ULL, 0x102040850005080ULL, 0x8850005008ULL, 0x8850005000ULL, 0x102040850005008ULL, 0x102040850005000ULL, 0x8850005088ULL, 0x8850005080ULL, 0x2040850005088ULL, 0x2040850005080ULL, 0x8850005008ULL, 0x8850005000ULL, 0x2040850005008ULL, 0x2040850005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8850005088ULL, 0x8850005080ULL, 0x40850005088ULL, 0x40850005080ULL, 0x8850005008ULL, 0x8850005000ULL, 0x40850005008ULL, 0x40850005000ULL, 0x8850005088ULL, 0x8850005080ULL, 0x40850005088ULL, 0x40850005080ULL, 0x8850005008ULL, 0x8850005000ULL, 0x40850005008ULL, 0x40850005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x8050005088ULL, 0x8050005080ULL, 0x50005088ULL, 0x50005080ULL, 0x8050005008ULL, 0x8050005000ULL, 0x50005008ULL, 0x50005000ULL, 0x2040810a000a010ULL, 0xa000a010ULL, 0x810a000a000ULL, 0xa000a000ULL, 0x10a000a000ULL, 0xa000a000ULL, 0x810a000a010ULL, 0xa000a010ULL, 0x40810a000a010ULL, 0xa000a010ULL, 0x10a000a000ULL, 0xa000a000ULL, 0x10a000a000ULL, 0xa000a000ULL, 0x810a000a010ULL, 0xa000a010ULL, 0x10a000a010ULL, 0xa000a010ULL, 0x10a000a000ULL, 0xa000a000ULL, 0x2040810a000a000ULL, 0xa000a000ULL, 0x10a000a010ULL, 0xa000a010ULL, 0x10a000a010ULL, 0xa000a010ULL, 0x810a000a000ULL, 0xa000a000ULL, 0x40810a000a000ULL, 0xa000a000ULL, 0x10a000a010ULL, 0xa000a010ULL, 0x408102040004020ULL, 0x2040004020ULL, 0x102040004020ULL, 0x2040004020ULL, 0x408102040004000ULL, 0x2040004000ULL, 0x102040004000ULL, 0x2040004000ULL, 0x40004020ULL, 0x40004020ULL, 0x40004020ULL, 0x40004020ULL, 0x40004000ULL, 0x40004000ULL, 0x40004000ULL, 0x40004000ULL, 0x102040004020ULL, 0x2040004020ULL, 0x8102040004020ULL, 0x2040004020ULL, 0x102040004000ULL, 0x2040004000ULL, 0x8102040004000ULL, 0x2040004000ULL, 0x40004020ULL, 0x40004020ULL, 0x40004020ULL, 0x40004020ULL, 0x40004000ULL, 0x40004000ULL, 0x40004000ULL, 0x40004000ULL, 0x1008040200020408ULL, 0x200020000ULL, 0x40200020408ULL, 0x200020000ULL, 0x8040200020408ULL, 0x200020000ULL, 0x40200020408ULL, 0x200020000ULL, 0x200020408ULL, 0x1008040200020000ULL, 0x200020408ULL, 0x40200020000ULL, 0x200020408ULL, 0x8040200020000ULL, 0x200020408ULL, 0x40200020000ULL, 0x1008040200020400ULL, 0x200020000ULL, 0x40200020400ULL, 0x200020000ULL, 0x8040200020400ULL, 0x200020000ULL, 0x40200020400ULL, 0x200020000ULL, 0x200020400ULL, 0x1008040200020000ULL, 0x200020400ULL, 0x40200020000ULL, 0x200020400ULL, 0x8040200020000ULL, 0x200020400ULL, 0x40200020000ULL, 0x2010080500050810ULL, 0x80500050000ULL, 0x500050800ULL, 0x500050000ULL, 0x10080500050810ULL, 0x2010080500050000ULL, 0x500050810ULL, 0x500050000ULL, 0x2010080500050800ULL, 0x10080500050000ULL, 0x500050810ULL, 0x500050000ULL, 0x10080500050800ULL, 0x2010080500050000ULL, 0x500050800ULL, 0x500050000ULL, 0x80500050810ULL, 0x10080500050000ULL, 0x500050800ULL, 0x500050000ULL, 0x80500050810ULL, 0x80500050000ULL, 0x500050810ULL, 0x500050000ULL, 0x80500050800ULL, 0x80500050000ULL, 0x500050810ULL, 0x500050000ULL, 0x80500050800ULL, 0x80500050000ULL, 0x500050800ULL, 0x500050000ULL, 0x4020110a000a1120ULL, 0xa000a0000ULL, 0x110a000a1020ULL, 0x110a000a1100ULL, 0x4020100a000a1120ULL, 0x4020110a000a1000ULL, 0x100a000a1020ULL, 0x100a000a1100ULL, 0x4020110a000a0100ULL, 0x4020100a000a1000ULL, 0x110a000a0000ULL, 0x110a000a0100ULL, 0x4020100a000a0100ULL, 0x4020110a000a0000ULL, 0x100a000a0000ULL, 0x100a000a0100ULL, 0x10a000a1120ULL, 0x4020100a000a0000ULL, 0x10a000a1020ULL, 0x10a000a1100ULL, 0xa000a1120ULL, 0x10a000a1000ULL, 0xa000a1020ULL, 0xa000a1100ULL, 0x10a000a0100ULL, 0xa000a1000ULL, 0x10a000a0000ULL, 0x10a000a0100ULL, 0xa000a0100ULL, 0x10a000a0000ULL, 0xa000a0000ULL, 0xa000a0100ULL, 0x110a000a1120ULL, 0xa000a0000ULL, 0x20110a000a1020ULL, 0x4020110a000a1100ULL, 0x100a000a1120ULL, 0x110a000a1000ULL, 0x20100a000a1020ULL, 0x4020100a000a1100ULL, 0x110a000a0100ULL, 0x100a000a1000ULL, 0x20110a000a0000ULL, 0x4020110a000a0100ULL, 0x100a000a0100ULL, 0x110a000a0000ULL, 0x20100a000a0000ULL, 0x4020100a000a0100ULL, 0x10a000a1120ULL, 0x100a000a0000ULL, 0x10a000a1020ULL, 0x10a000a1100ULL, 0xa000a1120ULL, 0x10a000a1000ULL, 0xa000a1020ULL, 0xa000a1100ULL, 0x10a000a0100ULL, 0xa000a1000ULL, 0x10a000a0000ULL, 0x10a000a0100ULL, 0xa000a0100ULL, 0x10a000a0000ULL, 0xa000a0000ULL, 0xa000a0100ULL, 0x20110a000a1120ULL, 0xa000a0000ULL, 0x110a000a1020ULL, 0x110a000a1100ULL, 0x20100a000a1120ULL, 0x20110a000a1000ULL, 0x100a000a1020ULL, 0x100a000a1100ULL, 0x20110a000a0100ULL, 0x20100a000a1000ULL, 0x110a000a0000ULL, 0x110a000a0100ULL, 0x20100a000a0100ULL, 0x20110a000a0000ULL, 0x100a000a0000ULL, 0x100a000a0100ULL, 0x10a000a1120ULL, 0x20100a000a0000ULL, 0x10a000a1020ULL, 0x10a000a1100ULL, 0xa000a1120ULL, 0x10a000a1000ULL, 0xa000a1020ULL, 0xa000a1100ULL, 0x10a000a0100ULL, 0xa000a1000ULL, 0x10a000a0000ULL, 0x10a000a0100ULL, 0xa000a0100ULL, 0x10a000a0000ULL, 0xa000a0000ULL, 0xa000a0100ULL, 0x110a000a1120ULL, 0xa000a0000ULL, 0x4020110a000a1020ULL, 0x20110a000a1100ULL, 0x100a000a1120ULL, 0x110a000a1000ULL, 0x4020100a000a1020ULL, 0x20100a000a1100ULL, 0x110a000a0100ULL, 0x100a000a1000ULL, 0x4020110a000a0000ULL, 0x20110a000a0100ULL, 0x100a000a0100ULL, 0x110a000a0000ULL, 0x4020100a000a0000ULL, 0x20100a000a0100ULL, 0x10a000a1120ULL, 0x100a000a0000ULL, 0x10a000a1020ULL, 0x10a000a1100ULL, 0xa000a1120ULL, 0x10a000a1000ULL, 0xa000a1020ULL, 0xa000a1100ULL, 0x10a000a0100ULL, 0xa000a1000ULL, 0x10a000a0000ULL, 0x10a000a0100ULL, 0xa000a0100ULL, 0x10a000a0000ULL, 0xa000a0000ULL, 0xa000a0100ULL, 0x8041221400142241ULL, 0x1400140201ULL, 0x8040221400142241ULL, 0x1400140201ULL, 0x8041221400142040ULL, 0x1400140000ULL, 0x8040221400142040ULL, 0x1400140000ULL, 0x1021400142240ULL, 0x201400140200ULL, 0x21400142240ULL, 0x201400140200ULL, 0x1021400142040ULL, 0x201400140000ULL, 0x21400142040ULL, 0x201400140000ULL, 0x8041221400140201ULL, 0x41221400142241ULL, 0x8040221400140201ULL, 0x40221400142241ULL, 0x8041221400140000ULL, 0x41221400142040ULL, 0x8040221400140000ULL, 0x40221400142040ULL, 0x1021400140200ULL, 0x1021400142240ULL, 0x21400140200ULL, 0x21400142240ULL, 0x1021400140000ULL, 0x1021400142040ULL, 0x21400140000ULL, 0x21400142040ULL, 0x1221400142241ULL, 0x41221400140201ULL, 0x221400142241ULL, 0x40221400140201ULL, 0x1221400142040ULL, 0x41221400140000ULL, 0x221400142040ULL, 0x40221400140000ULL, 0x1021400142240ULL, 0x1021400140200ULL, 0x21400142240ULL, 0x21400140200ULL, 0x1021400142040ULL, 0x1021400140000ULL, 0x21400142040ULL, 0x21400140000ULL, 0x1221400140201ULL, 0x1221400142241ULL, 0x221400140201ULL, 0x221400142241ULL, 0x1221400140000ULL, 0x1221400142040ULL, 0x221400140000ULL, 0x221400142040ULL, 0x1021400140200ULL, 0x1021400142240ULL, 0x21400140200ULL, 0x21400142240ULL, 0x1021400140000ULL, 0x1021400142040ULL, 0x21400140000ULL, 0x21400142040ULL, 0x8040201400142241ULL, 0x1221400140201ULL, 0x8040201400142241ULL, 0x221400140201ULL, 0x8040201400142040ULL, 0x1221400140000ULL, 0x8040201400142040ULL, 0x221400140000ULL, 0x1400142240ULL, 0x1021400140200ULL, 0x1400142240ULL, 0x21400140200ULL, 0x1400142040ULL, 0x1021400140000ULL, 0x1400142040ULL, 0x21400140000ULL, 0x8040201400140201ULL, 0x40201400142241ULL, 0x8040201400140201ULL, 0x40201400142241ULL, 0x8040201400140000ULL, 0x40201400142040ULL, 0x8040201400140000ULL, 0x40201400142040ULL, 0x1400140200ULL, 0x1400142240ULL, 0x1400140200ULL, 0x1400142240ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x201400142241ULL, 0x40201400140201ULL, 0x201400142241ULL, 0x40201400140201ULL, 0x201400142040ULL, 0x40201400140000ULL, 0x201400142040ULL, 0x40201400140000ULL, 0x1400142240ULL, 0x1400140200ULL, 0x1400142240ULL, 0x1400140200ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x201400140201ULL, 0x201400142241ULL, 0x201400140201ULL, 0x201400142241ULL, 0x201400140000ULL, 0x201400142040ULL, 0x201400140000ULL, 0x201400142040ULL, 0x1400140200ULL, 0x1400142240ULL, 0x1400140200ULL, 0x1400142240ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x8041221400142201ULL, 0x201400140201ULL, 0x8040221400142201ULL, 0x201400140201ULL, 0x8041221400142000ULL, 0x201400140000ULL, 0x8040221400142000ULL, 0x201400140000ULL, 0x1021400142200ULL, 0x1400140200ULL, 0x21400142200ULL, 0x1400140200ULL, 0x1021400142000ULL, 0x1400140000ULL, 0x21400142000ULL, 0x1400140000ULL, 0x8041221400140201ULL, 0x41221400142201ULL, 0x8040221400140201ULL, 0x40221400142201ULL, 0x8041221400140000ULL, 0x41221400142000ULL, 0x8040221400140000ULL, 0x40221400142000ULL, 0x1021400140200ULL, 0x1021400142200ULL, 0x21400140200ULL, 0x21400142200ULL, 0x1021400140000ULL, 0x1021400142000ULL, 0x21400140000ULL, 0x21400142000ULL, 0x1221400142201ULL, 0x41221400140201ULL, 0x221400142201ULL, 0x40221400140201ULL, 0x1221400142000ULL, 0x41221400140000ULL, 0x221400142000ULL, 0x40221400140000ULL, 0x1021400142200ULL, 0x1021400140200ULL, 0x21400142200ULL, 0x21400140200ULL, 0x1021400142000ULL, 0x1021400140000ULL, 0x21400142000ULL, 0x21400140000ULL, 0x1221400140201ULL, 0x1221400142201ULL, 0x221400140201ULL, 0x221400142201ULL, 0x1221400140000ULL, 0x1221400142000ULL, 0x221400140000ULL, 0x221400142000ULL, 0x1021400140200ULL, 0x1021400142200ULL, 0x21400140200ULL, 0x21400142200ULL, 0x1021400140000ULL, 0x1021400142000ULL, 0x21400140000ULL, 0x21400142000ULL, 0x8040201400142201ULL, 0x1221400140201ULL, 0x8040201400142201ULL, 0x221400140201ULL, 0x8040201400142000ULL, 0x1221400140000ULL, 0x8040201400142000ULL, 0x221400140000ULL, 0x1400142200ULL, 0x1021400140200ULL, 0x1400142200ULL, 0x21400140200ULL, 0x1400142000ULL, 0x1021400140000ULL, 0x1400142000ULL, 0x21400140000ULL, 0x8040201400140201ULL, 0x40201400142201ULL, 0x8040201400140201ULL, 0x40201400142201ULL, 0x8040201400140000ULL, 0x40201400142000ULL, 0x8040201400140000ULL, 0x40201400142000ULL, 0x1400140200ULL, 0x1400142200ULL, 0x1400140200ULL, 0x1400142200ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x201400142201ULL, 0x40201400140201ULL, 0x201400142201ULL, 0x40201400140201ULL, 0x201400142000ULL, 0x40201400140000ULL, 0x201400142000ULL, 0x40201400140000ULL, 0x1400142200ULL, 0x1400140200ULL, 0x1400142200ULL, 0x1400140200ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x201400140201ULL, 0x201400142201ULL, 0x201400140201ULL, 0x201400142201ULL, 0x201400140000ULL, 0x201400142000ULL, 0x201400140000ULL, 0x201400142000ULL, 0x1400140200ULL, 0x1400142200ULL, 0x1400140200ULL, 0x1400142200ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1021400142241ULL, 0x201400140201ULL, 0x21400142241ULL, 0x201400140201ULL, 0x1021400142040ULL, 0x201400140000ULL, 0x21400142040ULL, 0x201400140000ULL, 0x8041221400142240ULL, 0x1400140200ULL, 0x8040221400142240ULL, 0x1400140200ULL, 0x8041221400142040ULL, 0x1400140000ULL, 0x8040221400142040ULL, 0x1400140000ULL, 0x1021400140201ULL, 0x1021400142241ULL, 0x21400140201ULL, 0x21400142241ULL, 0x1021400140000ULL, 0x1021400142040ULL, 0x21400140000ULL, 0x21400142040ULL, 0x8041221400140200ULL, 0x41221400142240ULL, 0x8040221400140200ULL, 0x40221400142240ULL, 0x8041221400140000ULL, 0x41221400142040ULL, 0x8040221400140000ULL, 0x40221400142040ULL, 0x1021400142241ULL, 0x1021400140201ULL, 0x21400142241ULL, 0x21400140201ULL, 0x1021400142040ULL, 0x1021400140000ULL, 0x21400142040ULL, 0x21400140000ULL, 0x1221400142240ULL, 0x41221400140200ULL, 0x221400142240ULL, 0x40221400140200ULL, 0x1221400142040ULL, 0x41221400140000ULL, 0x221400142040ULL, 0x40221400140000ULL, 0x1021400140201ULL, 0x1021400142241ULL, 0x21400140201ULL, 0x21400142241ULL, 0x1021400140000ULL, 0x1021400142040ULL, 0x21400140000ULL, 0x21400142040ULL, 0x1221400140200ULL, 0x1221400142240ULL, 0x221400140200ULL, 0x221400142240ULL, 0x1221400140000ULL, 0x1221400142040ULL, 0x221400140000ULL, 0x221400142040ULL, 0x1400142241ULL, 0x1021400140201ULL, 0x1400142241ULL, 0x21400140201ULL, 0x1400142040ULL, 0x1021400140000ULL, 0x1400142040ULL, 0x21400140000ULL, 0x8040201400142240ULL, 0x1221400140200ULL, 0x8040201400142240ULL, 0x221400140200ULL, 0x8040201400142040ULL, 0x1221400140000ULL, 0x8040201400142040ULL, 0x221400140000ULL, 0x1400140201ULL, 0x1400142241ULL, 0x1400140201ULL, 0x1400142241ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x8040201400140200ULL, 0x40201400142240ULL, 0x8040201400140200ULL, 0x40201400142240ULL, 0x8040201400140000ULL, 0x40201400142040ULL, 0x8040201400140000ULL, 0x40201400142040ULL, 0x1400142241ULL, 0x1400140201ULL, 0x1400142241ULL, 0x1400140201ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x201400142240ULL, 0x40201400140200ULL, 0x201400142240ULL, 0x40201400140200ULL, 0x201400142040ULL, 0x40201400140000ULL, 0x201400142040ULL, 0x40201400140000ULL, 0x1400140201ULL, 0x1400142241ULL, 0x1400140201ULL, 0x1400142241ULL, 0x1400140000ULL, 0x1400142040ULL, 0x1400140000ULL, 0x1400142040ULL, 0x201400140200ULL, 0x201400142240ULL, 0x201400140200ULL, 0x201400142240ULL, 0x201400140000ULL, 0x201400142040ULL, 0x201400140000ULL, 0x201400142040ULL, 0x1021400142201ULL, 0x1400140201ULL, 0x21400142201ULL, 0x1400140201ULL, 0x1021400142000ULL, 0x1400140000ULL, 0x21400142000ULL, 0x1400140000ULL, 0x8041221400142200ULL, 0x201400140200ULL, 0x8040221400142200ULL, 0x201400140200ULL, 0x8041221400142000ULL, 0x201400140000ULL, 0x8040221400142000ULL, 0x201400140000ULL, 0x1021400140201ULL, 0x1021400142201ULL, 0x21400140201ULL, 0x21400142201ULL, 0x1021400140000ULL, 0x1021400142000ULL, 0x21400140000ULL, 0x21400142000ULL, 0x8041221400140200ULL, 0x41221400142200ULL, 0x8040221400140200ULL, 0x40221400142200ULL, 0x8041221400140000ULL, 0x41221400142000ULL, 0x8040221400140000ULL, 0x40221400142000ULL, 0x1021400142201ULL, 0x1021400140201ULL, 0x21400142201ULL, 0x21400140201ULL, 0x1021400142000ULL, 0x1021400140000ULL, 0x21400142000ULL, 0x21400140000ULL, 0x1221400142200ULL, 0x41221400140200ULL, 0x221400142200ULL, 0x40221400140200ULL, 0x1221400142000ULL, 0x41221400140000ULL, 0x221400142000ULL, 0x40221400140000ULL, 0x1021400140201ULL, 0x1021400142201ULL, 0x21400140201ULL, 0x21400142201ULL, 0x1021400140000ULL, 0x1021400142000ULL, 0x21400140000ULL, 0x21400142000ULL, 0x1221400140200ULL, 0x1221400142200ULL, 0x221400140200ULL, 0x221400142200ULL, 0x1221400140000ULL, 0x1221400142000ULL, 0x221400140000ULL, 0x221400142000ULL, 0x1400142201ULL, 0x1021400140201ULL, 0x1400142201ULL, 0x21400140201ULL, 0x1400142000ULL, 0x1021400140000ULL, 0x1400142000ULL, 0x21400140000ULL, 0x8040201400142200ULL, 0x1221400140200ULL, 0x8040201400142200ULL, 0x221400140200ULL, 0x8040201400142000ULL, 0x1221400140000ULL, 0x8040201400142000ULL, 0x221400140000ULL, 0x1400140201ULL, 0x1400142201ULL, 0x1400140201ULL, 0x1400142201ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x8040201400140200ULL, 0x40201400142200ULL, 0x8040201400140200ULL, 0x40201400142200ULL, 0x8040201400140000ULL, 0x40201400142000ULL, 0x8040201400140000ULL, 0x40201400142000ULL, 0x1400142201ULL, 0x1400140201ULL, 0x1400142201ULL, 0x1400140201ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x201400142200ULL, 0x40201400140200ULL, 0x201400142200ULL, 0x40201400140200ULL, 0x201400142000ULL, 0x40201400140000ULL, 0x201400142000ULL, 0x40201400140000ULL, 0x1400140201ULL, 0x1400142201ULL, 0x1400140201ULL, 0x1400142201ULL, 0x1400140000ULL, 0x1400142000ULL, 0x1400140000ULL, 0x1400142000ULL, 0x201400140200ULL, 0x201400142200ULL, 0x201400140200ULL, 0x201400142200ULL, 0x201400140000ULL, 0x201400142000ULL, 0x201400140000ULL, 0x201400142000ULL, 0x182442800284482ULL, 0x2042800284482ULL, 0x80442800284482ULL, 0x42800284482ULL, 0x182442800284080ULL, 0x2042800284080ULL, 0x80442800284080ULL, 0x42800284080ULL, 0x102042800284400ULL, 0x82442800284400ULL, 0x42800284400ULL, 0x80442800284400ULL, 0x102042800284000ULL, 0x82442800284000ULL, 0x42800284000ULL, 0x80442800284000ULL, 0x182442800280402ULL, 0x2042800280402ULL, 0x80442800280402ULL, 0x42800280402ULL, 0x182442800280000ULL, 0x2042800280000ULL, 0x80442800280000ULL, 0x42800280000ULL, 0x102042800280400ULL, 0x82442800280400ULL, 0x42800280400ULL, 0x80442800280400ULL, 0x102042800280000ULL, 0x82442800280000ULL, 0x42800280000ULL, 0x80442800280000ULL, 0x102442800284482ULL, 0x2042800284482ULL, 0x442800284482ULL, 0x42800284482ULL, 0x102442800284080ULL, 0x2042800284080ULL, 0x442800284080ULL, 0x42800284080ULL, 0x102042800284400ULL, 0x2442800284400ULL, 0x42800284400ULL, 0x442800284400ULL, 0x102042800284000ULL, 0x2442800284000ULL, 0x42800284000ULL, 0x442800284000ULL, 0x102442800280402ULL, 0x2042800280402ULL, 0x442800280402ULL, 0x42800280402ULL, 0x102442800280000ULL, 0x2042800280000ULL, 0x442800280000ULL, 0x42800280000ULL, 0x102042800280400ULL, 0x2442800280400ULL, 0x42800280400ULL, 0x442800280400ULL, 0x102042800280000ULL, 0x2442800280000ULL, 0x42800280000ULL, 0x442800280000ULL, 0x2800284482ULL, 0x80402800284482ULL, 0x2800284482ULL, 0x80402800284482ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x80402800284400ULL, 0x2800284400ULL, 0x80402800284400ULL, 0x2800284400ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x2800284482ULL, 0x402800284482ULL, 0x2800284482ULL, 0x402800284482ULL, 0x2800284080ULL, 0x402800284080ULL, 0x2800284080ULL, 0x402800284080ULL, 0x402800284400ULL, 0x2800284400ULL, 0x402800284400ULL, 0x2800284400ULL, 0x402800284000ULL, 0x2800284000ULL, 0x402800284000ULL, 0x2800284000ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x182442800284402ULL, 0x2042800284402ULL, 0x80442800284402ULL, 0x42800284402ULL, 0x182442800284000ULL, 0x2042800284000ULL, 0x80442800284000ULL, 0x42800284000ULL, 0x182442800284480ULL, 0x2042800284480ULL, 0x80442800284480ULL, 0x42800284480ULL, 0x182442800284080ULL, 0x2042800284080ULL, 0x80442800284080ULL, 0x42800284080ULL, 0x182442800280402ULL, 0x2042800280402ULL, 0x80442800280402ULL, 0x42800280402ULL, 0x182442800280000ULL, 0x2042800280000ULL, 0x80442800280000ULL, 0x42800280000ULL, 0x182442800280400ULL, 0x2042800280400ULL, 0x80442800280400ULL, 0x42800280400ULL, 0x182442800280000ULL, 0x2042800280000ULL, 0x80442800280000ULL, 0x42800280000ULL, 0x102442800284402ULL, 0x2042800284402ULL, 0x442800284402ULL, 0x42800284402ULL, 0x102442800284000ULL, 0x2042800284000ULL, 0x442800284000ULL, 0x42800284000ULL, 0x102442800284480ULL, 0x2042800284480ULL, 0x442800284480ULL, 0x42800284480ULL, 0x102442800284080ULL, 0x2042800284080ULL, 0x442800284080ULL, 0x42800284080ULL, 0x102442800280402ULL, 0x2042800280402ULL, 0x442800280402ULL, 0x42800280402ULL, 0x102442800280000ULL, 0x2042800280000ULL, 0x442800280000ULL, 0x42800280000ULL, 0x102442800280400ULL, 0x2042800280400ULL, 0x442800280400ULL, 0x42800280400ULL, 0x102442800280000ULL, 0x2042800280000ULL, 0x442800280000ULL, 0x42800280000ULL, 0x2800284402ULL, 0x80402800284402ULL, 0x2800284402ULL, 0x80402800284402ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x2800284480ULL, 0x80402800284480ULL, 0x2800284480ULL, 0x80402800284480ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800284402ULL, 0x402800284402ULL, 0x2800284402ULL, 0x402800284402ULL, 0x2800284000ULL, 0x402800284000ULL, 0x2800284000ULL, 0x402800284000ULL, 0x2800284480ULL, 0x402800284480ULL, 0x2800284480ULL, 0x402800284480ULL, 0x2800284080ULL, 0x402800284080ULL, 0x2800284080ULL, 0x402800284080ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x102042800284482ULL, 0x82442800284482ULL, 0x42800284482ULL, 0x80442800284482ULL, 0x102042800284080ULL, 0x82442800284080ULL, 0x42800284080ULL, 0x80442800284080ULL, 0x182442800284400ULL, 0x2042800284400ULL, 0x80442800284400ULL, 0x42800284400ULL, 0x182442800284000ULL, 0x2042800284000ULL, 0x80442800284000ULL, 0x42800284000ULL, 0x102042800280402ULL, 0x82442800280402ULL, 0x42800280402ULL, 0x80442800280402ULL, 0x102042800280000ULL, 0x82442800280000ULL, 0x42800280000ULL, 0x80442800280000ULL, 0x182442800280400ULL, 0x2042800280400ULL, 0x80442800280400ULL, 0x42800280400ULL, 0x182442800280000ULL, 0x2042800280000ULL, 0x80442800280000ULL, 0x42800280000ULL, 0x102042800284482ULL, 0x2442800284482ULL, 0x42800284482ULL, 0x442800284482ULL, 0x102042800284080ULL, 0x2442800284080ULL, 0x42800284080ULL, 0x442800284080ULL, 0x102442800284400ULL, 0x2042800284400ULL, 0x442800284400ULL, 0x42800284400ULL, 0x102442800284000ULL, 0x2042800284000ULL, 0x442800284000ULL, 0x42800284000ULL, 0x102042800280402ULL, 0x2442800280402ULL, 0x42800280402ULL, 0x442800280402ULL, 0x102042800280000ULL, 0x2442800280000ULL, 0x42800280000ULL, 0x442800280000ULL, 0x102442800280400ULL, 0x2042800280400ULL, 0x442800280400ULL, 0x42800280400ULL, 0x102442800280000ULL, 0x2042800280000ULL, 0x442800280000ULL, 0x42800280000ULL, 0x80402800284482ULL, 0x2800284482ULL, 0x80402800284482ULL, 0x2800284482ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x2800284400ULL, 0x80402800284400ULL, 0x2800284400ULL, 0x80402800284400ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x402800284482ULL, 0x2800284482ULL, 0x402800284482ULL, 0x2800284482ULL, 0x402800284080ULL, 0x2800284080ULL, 0x402800284080ULL, 0x2800284080ULL, 0x2800284400ULL, 0x402800284400ULL, 0x2800284400ULL, 0x402800284400ULL, 0x2800284000ULL, 0x402800284000ULL, 0x2800284000ULL, 0x402800284000ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x102042800284402ULL, 0x82442800284402ULL, 0x42800284402ULL, 0x80442800284402ULL, 0x102042800284000ULL, 0x82442800284000ULL, 0x42800284000ULL, 0x80442800284000ULL, 0x102042800284480ULL, 0x82442800284480ULL, 0x42800284480ULL, 0x80442800284480ULL, 0x102042800284080ULL, 0x82442800284080ULL, 0x42800284080ULL, 0x80442800284080ULL, 0x102042800280402ULL, 0x82442800280402ULL, 0x42800280402ULL, 0x80442800280402ULL, 0x102042800280000ULL, 0x82442800280000ULL, 0x42800280000ULL, 0x80442800280000ULL, 0x102042800280400ULL, 0x82442800280400ULL, 0x42800280400ULL, 0x80442800280400ULL, 0x102042800280000ULL, 0x82442800280000ULL, 0x42800280000ULL, 0x80442800280000ULL, 0x102042800284402ULL, 0x2442800284402ULL, 0x42800284402ULL, 0x442800284402ULL, 0x102042800284000ULL, 0x2442800284000ULL, 0x42800284000ULL, 0x442800284000ULL, 0x102042800284480ULL, 0x2442800284480ULL, 0x42800284480ULL, 0x442800284480ULL, 0x102042800284080ULL, 0x2442800284080ULL, 0x42800284080ULL, 0x442800284080ULL, 0x102042800280402ULL, 0x2442800280402ULL, 0x42800280402ULL, 0x442800280402ULL, 0x102042800280000ULL, 0x2442800280000ULL, 0x42800280000ULL, 0x442800280000ULL, 0x102042800280400ULL, 0x2442800280400ULL, 0x42800280400ULL, 0x442800280400ULL, 0x102042800280000ULL, 0x2442800280000ULL, 0x42800280000ULL, 0x442800280000ULL, 0x80402800284402ULL, 0x2800284402ULL, 0x80402800284402ULL, 0x2800284402ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x80402800284000ULL, 0x2800284000ULL, 0x80402800284480ULL, 0x2800284480ULL, 0x80402800284480ULL, 0x2800284480ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x80402800284080ULL, 0x2800284080ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280402ULL, 0x2800280402ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280400ULL, 0x2800280400ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x80402800280000ULL, 0x2800280000ULL, 0x402800284402ULL, 0x2800284402ULL, 0x402800284402ULL, 0x2800284402ULL, 0x402800284000ULL, 0x2800284000ULL, 0x402800284000ULL, 0x2800284000ULL, 0x402800284480ULL, 0x2800284480ULL, 0x402800284480ULL, 0x2800284480ULL, 0x402800284080ULL, 0x2800284080ULL, 0x402800284080ULL, 0x2800284080ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280402ULL, 0x2800280402ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280400ULL, 0x2800280400ULL, 0x402800280000ULL, 0x2800280000ULL, 0x402800280000ULL, 0x2800280000ULL, 0x204885000508804ULL, 0x204885000500804ULL, 0x4885000508804ULL, 0x4885000500804ULL, 0x805000508804ULL, 0x805000500804ULL, 0x805000508804ULL, 0x805000500804ULL, 0x885000508804ULL, 0x885000500804ULL, 0x885000508804ULL, 0x885000500804ULL, 0x805000508804ULL, 0x805000500804ULL, 0x805000508804ULL, 0x805000500804ULL, 0x204085000508804ULL, 0x204085000500804ULL, 0x4085000508804ULL, 0x4085000500804ULL, 0x5000508804ULL, 0x5000500804ULL, 0x5000508804ULL, 0x5000500804ULL, 0x85000508804ULL, 0x85000500804ULL, 0x85000508804ULL, 0x85000500804ULL, 0x5000508804ULL, 0x5000500804ULL, 0x5000508804ULL, 0x5000500804ULL, 0x204885000508000ULL, 0x204885000500000ULL, 0x4885000508000ULL, 0x4885000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x885000508000ULL, 0x885000500000ULL, 0x885000508000ULL, 0x885000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x204085000508000ULL, 0x204085000500000ULL, 0x4085000508000ULL, 0x4085000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x85000508000ULL, 0x85000500000ULL, 0x85000508000ULL, 0x85000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x204885000508800ULL, 0x204885000500800ULL, 0x4885000508800ULL, 0x4885000500800ULL, 0x805000508800ULL, 0x805000500800ULL, 0x805000508800ULL, 0x805000500800ULL, 0x885000508800ULL, 0x885000500800ULL, 0x885000508800ULL, 0x885000500800ULL, 0x805000508800ULL, 0x805000500800ULL, 0x805000508800ULL, 0x805000500800ULL, 0x204085000508800ULL, 0x204085000500800ULL, 0x4085000508800ULL, 0x4085000500800ULL, 0x5000508800ULL, 0x5000500800ULL, 0x5000508800ULL, 0x5000500800ULL, 0x85000508800ULL, 0x85000500800ULL, 0x85000508800ULL, 0x85000500800ULL, 0x5000508800ULL, 0x5000500800ULL, 0x5000508800ULL, 0x5000500800ULL, 0x204885000508000ULL, 0x204885000500000ULL, 0x4885000508000ULL, 0x4885000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x885000508000ULL, 0x885000500000ULL, 0x885000508000ULL, 0x885000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x805000508000ULL, 0x805000500000ULL, 0x204085000508000ULL, 0x204085000500000ULL, 0x4085000508000ULL, 0x4085000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x85000508000ULL, 0x85000500000ULL, 0x85000508000ULL, 0x85000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x5000508000ULL, 0x5000500000ULL, 0x40810a000a01008ULL, 0xa000a01000ULL, 0x10a000a00000ULL, 0xa000a00000ULL, 0x810a000a00000ULL, 0xa000a00000ULL, 0x10a000a01008ULL, 0xa000a01000ULL, 0x810a000a01008ULL, 0xa000a01000ULL, 0x10a000a00000ULL, 0xa000a00000ULL, 0x40810a000a00000ULL, 0xa000a00000ULL, 0x10a000a01008ULL, 0xa000a01000ULL, 0x40810a000a01000ULL, 0xa000a01008ULL, 0x10a000a00000ULL, 0xa000a00000ULL, 0x810a000a00000ULL, 0xa000a00000ULL, 0x10a000a01000ULL, 0xa000a01008ULL, 0x810a000a01000ULL, 0xa000a01008ULL, 0x10a000a00000ULL, 0xa000a00000ULL, 0x40810a000a00000ULL, 0xa000a00000ULL, 0x10a000a01000ULL, 0xa000a01008ULL, 0x810204000402010ULL, 0x4000402010ULL, 0x204000402000ULL, 0x4000402000ULL, 0x204000402010ULL, 0x4000402010ULL, 0x810204000402000ULL, 0x4000402000ULL, 0x10204000400000ULL, 0x4000400000ULL, 0x204000402000ULL, 0x4000402000ULL, 0x204000400000ULL, 0x4000400000ULL, 0x10204000400000ULL, 0x4000400000ULL, 0x810204000400000ULL, 0x4000400000ULL, 0x204000400000ULL, 0x4000400000ULL, 0x204000400000ULL, 0x4000400000ULL, 0x810204000400000ULL, 0x4000400000ULL, 0x10204000402010ULL, 0x4000402010ULL, 0x204000400000ULL, 0x4000400000ULL, 0x204000402010ULL, 0x4000402010ULL, 0x10204000402000ULL, 0x4000402000ULL, 0x804020002040810ULL, 0x804020002040800ULL, 0x4020002000000ULL, 0x4020002000000ULL, 0x20002000000ULL, 0x20002000000ULL, 0x20002040810ULL, 0x20002040800ULL, 0x804020002040000ULL, 0x804020002040000ULL, 0x4020002000000ULL, 0x4020002000000ULL, 0x20002000000ULL, 0x20002000000ULL, 0x20002040000ULL, 0x20002040000ULL, 0x804020002000000ULL, 0x804020002000000ULL, 0x4020002040810ULL, 0x4020002040800ULL, 0x20002040810ULL, 0x20002040800ULL, 0x20002000000ULL, 0x20002000000ULL, 0x804020002000000ULL, 0x804020002000000ULL, 0x4020002040000ULL, 0x4020002040000ULL, 0x20002040000ULL, 0x20002040000ULL, 0x20002000000ULL, 0x20002000000ULL, 0x1008050005081020ULL, 0x50005000000ULL, 0x1008050005080000ULL, 0x8050005081020ULL, 0x50005081020ULL, 0x8050005080000ULL, 0x50005080000ULL, 0x50005081020ULL, 0x1008050005000000ULL, 0x50005080000ULL, 0x1008050005000000ULL, 0x8050005000000ULL, 0x50005000000ULL, 0x8050005000000ULL, 0x50005000000ULL, 0x50005000000ULL, 0x1008050005081000ULL, 0x50005000000ULL, 0x1008050005080000ULL, 0x8050005081000ULL, 0x50005081000ULL, 0x8050005080000ULL, 0x50005080000ULL, 0x50005081000ULL, 0x1008050005000000ULL, 0x50005080000ULL, 0x1008050005000000ULL, 0x8050005000000ULL, 0x50005000000ULL, 0x8050005000000ULL, 0x50005000000ULL, 0x50005000000ULL, 0x20110a000a112040ULL, 0x20100a000a112040ULL, 0x20110a000a112000ULL, 0x20100a000a112000ULL, 0x10a000a112040ULL, 0xa000a112040ULL, 0x10a000a112000ULL, 0xa000a112000ULL, 0x20110a000a110000ULL, 0x20100a000a110000ULL, 0x20110a000a110000ULL, 0x20100a000a110000ULL, 0x10a000a110000ULL, 0xa000a110000ULL, 0x10a000a110000ULL, 0xa000a110000ULL, 0x20110a000a102040ULL, 0x20100a000a102040ULL, 0x20110a000a102000ULL, 0x20100a000a102000ULL, 0x10a000a102040ULL, 0xa000a102040ULL, 0x10a000a102000ULL, 0xa000a102000ULL, 0x20110a000a100000ULL, 0x20100a000a100000ULL, 0x20110a000a100000ULL, 0x20100a000a100000ULL, 0x10a000a100000ULL, 0xa000a100000ULL, 0x10a000a100000ULL, 0xa000a100000ULL, 0x110a000a112040ULL, 0x100a000a112040ULL, 0x110a000a112000ULL, 0x100a000a112000ULL, 0x10a000a112040ULL, 0xa000a112040ULL, 0x10a000a112000ULL, 0xa000a112000ULL, 0x110a000a110000ULL, 0x100a000a110000ULL, 0x110a000a110000ULL, 0x100a000a110000ULL, 0x10a000a110000ULL, 0xa000a110000ULL, 0x10a000a110000ULL, 0xa000a110000ULL, 0x110a000a102040ULL, 0x100a000a102040ULL, 0x110a000a102000ULL, 0x100a000a102000ULL, 0x10a000a102040ULL, 0xa000a102040ULL, 0x10a000a102000ULL, 0xa000a102000ULL, 0x110a000a100000ULL, 0x100a000a100000ULL, 0x110a000a100000ULL, 0x100a000a100000ULL, 0x10a000a100000ULL, 0xa000a100000ULL, 0x10a000a100000ULL, 0xa000a100000ULL, 0x20110a000a010000ULL, 0x20100a000a010000ULL, 0x20110a000a010000ULL, 0x20100a000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x20110a000a010000ULL, 0x20100a000a010000ULL, 0x20110a000a010000ULL, 0x20100a000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x20110a000a000000ULL, 0x20100a000a000000ULL, 0x20110a000a000000ULL, 0x20100a000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x20110a000a000000ULL, 0x20100a000a000000ULL, 0x20110a000a000000ULL, 0x20100a000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x110a000a010000ULL, 0x100a000a010000ULL, 0x110a000a010000ULL, 0x100a000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x110a000a010000ULL, 0x100a000a010000ULL, 0x110a000a010000ULL, 0x100a000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x10a000a010000ULL, 0xa000a010000ULL, 0x110a000a000000ULL, 0x100a000a000000ULL, 0x110a000a000000ULL, 0x100a000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x110a000a000000ULL, 0x100a000a000000ULL, 0x110a000a000000ULL, 0x100a000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x10a000a000000ULL, 0xa000a000000ULL, 0x4122140014224180ULL, 0x102140014000000ULL, 0x20140014020000ULL, 0x140014200000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x4122140014220100ULL, 0x102140014000000ULL, 0x22140014020000ULL, 0x2140014204080ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x4122140014224100ULL, 0x102140014000000ULL, 0x22140014020000ULL, 0x2140014200000ULL, 0x4020140014224180ULL, 0x140014000000ULL, 0x4122140014220100ULL, 0x102140014000000ULL, 0x22140014020000ULL, 0x2140014204000ULL, 0x4020140014220100ULL, 0x140014000000ULL, 0x20140014020000ULL, 0x140014204080ULL, 0x22140014020000ULL, 0x2140014200000ULL, 0x4020140014224100ULL, 0x140014000000ULL, 0x20140014020000ULL, 0x140014200000ULL, 0x4122140014000000ULL, 0x102140014020000ULL, 0x4020140014220100ULL, 0x140014000000ULL, 0x20140014020000ULL, 0x140014204000ULL, 0x4122140014000000ULL, 0x102140014020000ULL, 0x4022140014224180ULL, 0x2140014000000ULL, 0x20140014020000ULL, 0x140014200000ULL, 0x4122140014000000ULL, 0x102140014020000ULL, 0x4022140014220100ULL, 0x2140014000000ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4122140014000000ULL, 0x102140014020000ULL, 0x4022140014224100ULL, 0x2140014000000ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4020140014224180ULL, 0x140014000000ULL, 0x4022140014220100ULL, 0x2140014000000ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4020140014220100ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014224180ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4020140014224100ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014220100ULL, 0x4022140014000000ULL, 0x2140014020000ULL, 0x4020140014220100ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014224100ULL, 0x4022140014000000ULL, 0x2140014020000ULL, 0x20140014000000ULL, 0x140014224180ULL, 0x122140014000000ULL, 0x102140014220100ULL, 0x4022140014000000ULL, 0x2140014020000ULL, 0x20140014000000ULL, 0x140014220100ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4022140014000000ULL, 0x2140014020000ULL, 0x20140014000000ULL, 0x140014224100ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4122140014224080ULL, 0x102140014000000ULL, 0x20140014000000ULL, 0x140014220100ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4122140014220000ULL, 0x102140014000000ULL, 0x22140014000000ULL, 0x2140014224180ULL, 0x4020140014000000ULL, 0x140014020000ULL, 0x4122140014224000ULL, 0x102140014000000ULL, 0x22140014000000ULL, 0x2140014220100ULL, 0x4020140014224080ULL, 0x140014000000ULL, 0x4122140014220000ULL, 0x102140014000000ULL, 0x22140014000000ULL, 0x2140014224100ULL, 0x4020140014220000ULL, 0x140014000000ULL, 0x20140014000000ULL, 0x140014224180ULL, 0x22140014000000ULL, 0x2140014220100ULL, 0x4020140014224000ULL, 0x140014000000ULL, 0x20140014000000ULL, 0x140014220100ULL, 0x122140014224180ULL, 0x102140014000000ULL, 0x4020140014220000ULL, 0x140014000000ULL, 0x20140014000000ULL, 0x140014224100ULL, 0x122140014220100ULL, 0x102140014000000ULL, 0x4022140014224080ULL, 0x2140014000000ULL, 0x20140014000000ULL, 0x140014220100ULL, 0x122140014224100ULL, 0x102140014000000ULL, 0x4022140014220000ULL, 0x2140014000000ULL, 0x20140014224180ULL, 0x140014000000ULL, 0x122140014220100ULL, 0x102140014000000ULL, 0x4022140014224000ULL, 0x2140014000000ULL, 0x20140014220100ULL, 0x140014000000ULL, 0x4020140014224080ULL, 0x140014000000ULL, 0x4022140014220000ULL, 0x2140014000000ULL, 0x20140014224100ULL, 0x140014000000ULL, 0x4020140014220000ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014224080ULL, 0x20140014220100ULL, 0x140014000000ULL, 0x4020140014224000ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014220000ULL, 0x22140014224180ULL, 0x2140014000000ULL, 0x4020140014220000ULL, 0x140014000000ULL, 0x122140014000000ULL, 0x102140014224000ULL, 0x22140014220100ULL, 0x2140014000000ULL, 0x20140014000000ULL, 0x140014224080ULL, 0x122140014000000ULL, 0x102140014220000ULL, 0x22140014224100ULL, 0x2140014000000ULL, 0x20140014000000ULL, 0x140014220000ULL, 0x20140014224180ULL, 0x140014000000ULL, 0x22140014220100ULL, 0x2140014000000ULL, 0x20140014000000ULL, 0x140014224000ULL, 0x20140014220100ULL, 0x140014000000ULL, 0x4122140014204080ULL, 0x102140014224180ULL, 0x20140014000000ULL, 0x140014220000ULL, 0x20140014224100ULL, 0x140014000000ULL, 0x4122140014200000ULL, 0x102140014220100ULL, 0x22140014000000ULL, 0x2140014224080ULL, 0x20140014220100ULL, 0x140014000000ULL, 0x4122140014204000ULL, 0x102140014224100ULL, 0x22140014000000ULL, 0x2140014220000ULL, 0x4020140014204080ULL, 0x140014224180ULL, 0x4122140014200000ULL, 0x102140014220100ULL, 0x22140014000000ULL, 0x2140014224000ULL, 0x4020140014200000ULL, 0x140014220100ULL, 0x20140014000000ULL, 0x140014224080ULL, 0x22140014000000ULL, 0x2140014220000ULL, 0x4020140014204000ULL, 0x140014224100ULL, 0x20140014000000ULL, 0x140014220000ULL, 0x122140014224080ULL, 0x102140014000000ULL, 0x4020140014200000ULL, 0x140014220100ULL, 0x20140014000000ULL, 0x140014224000ULL, 0x122140014220000ULL, 0x102140014000000ULL, 0x4022140014204080ULL, 0x2140014224180ULL, 0x20140014000000ULL, 0x140014220000ULL, 0x122140014224000ULL, 0x102140014000000ULL, 0x4022140014200000ULL, 0x2140014220100ULL, 0x20140014224080ULL, 0x140014000000ULL, 0x122140014220000ULL, 0x102140014000000ULL, 0x4022140014204000ULL, 0x2140014224100ULL, 0x20140014220000ULL, 0x140014000000ULL, 0x4020140014204080ULL, 0x140014224180ULL, 0x4022140014200000ULL, 0x2140014220100ULL, 0x20140014224000ULL, 0x140014000000ULL, 0x4020140014200000ULL, 0x140014220100ULL, 0x4122140014020100ULL, 0x102140014204080ULL, 0x20140014220000ULL, 0x140014000000ULL, 0x4020140014204000ULL, 0x140014224100ULL, 0x4122140014020100ULL, 0x102140014200000ULL, 0x22140014224080ULL, 0x2140014000000ULL, 0x4020140014200000ULL, 0x140014220100ULL, 0x4122140014020100ULL, 0x102140014204000ULL, 0x22140014220000ULL, 0x2140014000000ULL, 0x4020140014020100ULL, 0x140014204080ULL, 0x4122140014020100ULL, 0x102140014200000ULL, 0x22140014224000ULL, 0x2140014000000ULL, 0x4020140014020100ULL, 0x140014200000ULL, 0x20140014224080ULL, 0x140014000000ULL, 0x22140014220000ULL, 0x2140014000000ULL, 0x4020140014020100ULL, 0x140014204000ULL, 0x20140014220000ULL, 0x140014000000ULL, 0x4122140014204080ULL, 0x102140014224080ULL, 0x4020140014020100ULL, 0x140014200000ULL, 0x20140014224000ULL, 0x140014000000ULL, 0x4122140014200000ULL, 0x102140014220000ULL, 0x4022140014020100ULL, 0x2140014204080ULL, 0x20140014220000ULL, 0x140014000000ULL, 0x4122140014204000ULL, 0x102140014224000ULL, 0x4022140014020100ULL, 0x2140014200000ULL, 0x4020140014204080ULL, 0x140014224080ULL, 0x4122140014200000ULL, 0x102140014220000ULL, 0x4022140014020100ULL, 0x2140014204000ULL, 0x4020140014200000ULL, 0x140014220000ULL, 0x4020140014020100ULL, 0x140014204080ULL, 0x4022140014020100ULL, 0x2140014200000ULL, 0x4020140014204000ULL, 0x140014224000ULL, 0x4020140014020100ULL, 0x140014200000ULL, 0x122140014204080ULL, 0x102140014020100ULL, 0x4020140014200000ULL, 0x140014220000ULL, 0x4020140014020100ULL, 0x140014204000ULL, 0x122140014200000ULL, 0x102140014020100ULL, 0x4022140014204080ULL, 0x2140014224080ULL, 0x4020140014020100ULL, 0x140014200000ULL, 0x122140014204000ULL, 0x102140014020100ULL, 0x4022140014200000ULL, 0x2140014220000ULL, 0x20140014204080ULL, 0x140014020100ULL, 0x122140014200000ULL, 0x102140014020100ULL, 0x4022140014204000ULL, 0x2140014224000ULL, 0x20140014200000ULL, 0x140014020100ULL, 0x4020140014204080ULL, 0x140014224080ULL, 0x4022140014200000ULL, 0x2140014220000ULL, 0x20140014204000ULL, 0x140014020100ULL, 0x4020140014200000ULL, 0x140014220000ULL, 0x4122140014020000ULL, 0x102140014204080ULL, 0x20140014200000ULL, 0x140014020100ULL, 0x4020140014204000ULL, 0x140014224000ULL, 0x4122140014020000ULL, 0x102140014200000ULL, 0x22140014204080ULL, 0x2140014020100ULL, 0x4020140014200000ULL, 0x140014220000ULL, 0x4122140014020000ULL, 0x102140014204000ULL, 0x22140014200000ULL, 0x2140014020100ULL, 0x4020140014020000ULL, 0x140014204080ULL, 0x4122140014020000ULL, 0x102140014200000ULL, 0x22140014204000ULL, 0x2140014020100ULL, 0x4020140014020000ULL, 0x140014200000ULL, 0x20140014204080ULL, 0x140014020100ULL, 0x22140014200000ULL, 0x2140014020100ULL, 0x4020140014020000ULL, 0x140014204000ULL, 0x20140014200000ULL, 0x140014020100ULL, 0x122140014020100ULL, 0x102140014204080ULL, 0x4020140014020000ULL, 0x140014200000ULL, 0x20140014204000ULL, 0x140014020100ULL, 0x122140014020100ULL, 0x102140014200000ULL, 0x4022140014020000ULL, 0x2140014204080ULL, 0x20140014200000ULL, 0x140014020100ULL, 0x122140014020100ULL, 0x102140014204000ULL, 0x4022140014020000ULL, 0x2140014200000ULL, 0x20140014020100ULL, 0x140014204080ULL, 0x122140014020100ULL, 0x102140014200000ULL, 0x4022140014020000ULL, 0x2140014204000ULL, 0x20140014020100ULL, 0x140014200000ULL, 0x4020140014020000ULL, 0x140014204080ULL, 0x4022140014020000ULL, 0x2140014200000ULL, 0x20140014020100ULL, 0x140014204000ULL, 0x4020140014020000ULL, 0x140014200000ULL, 0x122140014204080ULL, 0x102140014020000ULL, 0x20140014020100ULL, 0x140014200000ULL, 0x4020140014020000ULL, 0x140014204000ULL, 0x122140014200000ULL, 0x102140014020000ULL, 0x22140014020100ULL, 0x2140014204080ULL, 0x4020140014020000ULL, 0x140014200000ULL, 0x122140014204000ULL, 0x102140014020000ULL, 0x22140014020100ULL, 0x2140014200000ULL, 0x20140014204080ULL, 0x140014020000ULL, 0x122140014200000ULL, 0x102140014020000ULL, 0x22140014020100ULL, 0x2140014204000ULL, 0x20140014200000ULL, 0x140014020000ULL, 0x20140014020100ULL, 0x140014204080ULL, 0x22140014020100ULL, 0x2140014200000ULL, 0x20140014204000ULL, 0x140014020000ULL, 0x20140014020100ULL, 0x140014200000ULL, 0x4122140014000000ULL, 0x102140014020100ULL, 0x20140014200000ULL, 0x140014020000ULL, 0x20140014020100ULL, 0x140014204000ULL, 0x4122140014000000ULL, 0x102140014020100ULL, 0x22140014204080ULL, 0x2140014020000ULL, 0x20140014020100ULL, 0x140014200000ULL, 0x4122140014000000ULL, 0x102140014020100ULL, 0x22140014200000ULL, 0x2140014020000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x4122140014000000ULL, 0x102140014020100ULL, 0x22140014204000ULL, 0x2140014020000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x20140014204080ULL, 0x140014020000ULL, 0x22140014200000ULL, 0x2140014020000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x20140014200000ULL, 0x140014020000ULL, 0x122140014020000ULL, 0x102140014204080ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x20140014204000ULL, 0x140014020000ULL, 0x122140014020000ULL, 0x102140014200000ULL, 0x4022140014000000ULL, 0x2140014020100ULL, 0x20140014200000ULL, 0x140014020000ULL, 0x122140014020000ULL, 0x102140014204000ULL, 0x4022140014000000ULL, 0x2140014020100ULL, 0x20140014020000ULL, 0x140014204080ULL, 0x122140014020000ULL, 0x102140014200000ULL, 0x4022140014000000ULL, 0x2140014020100ULL, 0x20140014020000ULL, 0x140014200000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x4022140014000000ULL, 0x2140014020100ULL, 0x20140014020000ULL, 0x140014204000ULL, 0x4020140014000000ULL, 0x140014020100ULL, 0x8244280028448201ULL, 0x8244280028408000ULL, 0x204280028448000ULL, 0x204280028408000ULL, 0x8244280028040201ULL, 0x8244280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x8044280028448201ULL, 0x8044280028408000ULL, 0x4280028448000ULL, 0x4280028408000ULL, 0x8044280028040201ULL, 0x8044280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x8244280028448200ULL, 0x8244280028408000ULL, 0x204280028448000ULL, 0x204280028408000ULL, 0x8244280028040200ULL, 0x8244280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x8044280028448200ULL, 0x8044280028408000ULL, 0x4280028448000ULL, 0x4280028408000ULL, 0x8044280028040200ULL, 0x8044280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x8244280028440201ULL, 0x8244280028400000ULL, 0x204280028440000ULL, 0x204280028400000ULL, 0x8244280028040201ULL, 0x8244280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x8044280028440201ULL, 0x8044280028400000ULL, 0x4280028440000ULL, 0x4280028400000ULL, 0x8044280028040201ULL, 0x8044280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x8244280028440200ULL, 0x8244280028400000ULL, 0x204280028440000ULL, 0x204280028400000ULL, 0x8244280028040200ULL, 0x8244280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x8044280028440200ULL, 0x8044280028400000ULL, 0x4280028440000ULL, 0x4280028400000ULL, 0x8044280028040200ULL, 0x8044280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x8040280028448201ULL, 0x8040280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x8040280028040201ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028448201ULL, 0x8040280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x8040280028040201ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028448200ULL, 0x8040280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x8040280028040200ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028448200ULL, 0x8040280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x8040280028040200ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028440201ULL, 0x8040280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x8040280028040201ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028440201ULL, 0x8040280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x8040280028040201ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028440200ULL, 0x8040280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x8040280028040200ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x8040280028440200ULL, 0x8040280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x8040280028040200ULL, 0x8040280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x244280028448201ULL, 0x244280028408000ULL, 0x8244280028448000ULL, 0x8244280028408000ULL, 0x244280028040201ULL, 0x244280028000000ULL, 0x8244280028040000ULL, 0x8244280028000000ULL, 0x44280028448201ULL, 0x44280028408000ULL, 0x8044280028448000ULL, 0x8044280028408000ULL, 0x44280028040201ULL, 0x44280028000000ULL, 0x8044280028040000ULL, 0x8044280028000000ULL, 0x244280028448200ULL, 0x244280028408000ULL, 0x8244280028448000ULL, 0x8244280028408000ULL, 0x244280028040200ULL, 0x244280028000000ULL, 0x8244280028040000ULL, 0x8244280028000000ULL, 0x44280028448200ULL, 0x44280028408000ULL, 0x8044280028448000ULL, 0x8044280028408000ULL, 0x44280028040200ULL, 0x44280028000000ULL, 0x8044280028040000ULL, 0x8044280028000000ULL, 0x244280028440201ULL, 0x244280028400000ULL, 0x8244280028440000ULL, 0x8244280028400000ULL, 0x244280028040201ULL, 0x244280028000000ULL, 0x8244280028040000ULL, 0x8244280028000000ULL, 0x44280028440201ULL, 0x44280028400000ULL, 0x8044280028440000ULL, 0x8044280028400000ULL, 0x44280028040201ULL, 0x44280028000000ULL, 0x8044280028040000ULL, 0x8044280028000000ULL, 0x244280028440200ULL, 0x244280028400000ULL, 0x8244280028440000ULL, 0x8244280028400000ULL, 0x244280028040200ULL, 0x244280028000000ULL, 0x8244280028040000ULL, 0x8244280028000000ULL, 0x44280028440200ULL, 0x44280028400000ULL, 0x8044280028440000ULL, 0x8044280028400000ULL, 0x44280028040200ULL, 0x44280028000000ULL, 0x8044280028040000ULL, 0x8044280028000000ULL, 0x40280028448201ULL, 0x40280028408000ULL, 0x8040280028448000ULL, 0x8040280028408000ULL, 0x40280028040201ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028448201ULL, 0x40280028408000ULL, 0x8040280028448000ULL, 0x8040280028408000ULL, 0x40280028040201ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028448200ULL, 0x40280028408000ULL, 0x8040280028448000ULL, 0x8040280028408000ULL, 0x40280028040200ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028448200ULL, 0x40280028408000ULL, 0x8040280028448000ULL, 0x8040280028408000ULL, 0x40280028040200ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028440201ULL, 0x40280028400000ULL, 0x8040280028440000ULL, 0x8040280028400000ULL, 0x40280028040201ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028440201ULL, 0x40280028400000ULL, 0x8040280028440000ULL, 0x8040280028400000ULL, 0x40280028040201ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028440200ULL, 0x40280028400000ULL, 0x8040280028440000ULL, 0x8040280028400000ULL, 0x40280028040200ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x40280028440200ULL, 0x40280028400000ULL, 0x8040280028440000ULL, 0x8040280028400000ULL, 0x40280028040200ULL, 0x40280028000000ULL, 0x8040280028040000ULL, 0x8040280028000000ULL, 0x204280028448201ULL, 0x204280028408000ULL, 0x244280028448000ULL, 0x244280028408000ULL, 0x204280028040201ULL, 0x204280028000000ULL, 0x244280028040000ULL, 0x244280028000000ULL, 0x4280028448201ULL, 0x4280028408000ULL, 0x44280028448000ULL, 0x44280028408000ULL, 0x4280028040201ULL, 0x4280028000000ULL, 0x44280028040000ULL, 0x44280028000000ULL, 0x204280028448200ULL, 0x204280028408000ULL, 0x244280028448000ULL, 0x244280028408000ULL, 0x204280028040200ULL, 0x204280028000000ULL, 0x244280028040000ULL, 0x244280028000000ULL, 0x4280028448200ULL, 0x4280028408000ULL, 0x44280028448000ULL, 0x44280028408000ULL, 0x4280028040200ULL, 0x4280028000000ULL, 0x44280028040000ULL, 0x44280028000000ULL, 0x204280028440201ULL, 0x204280028400000ULL, 0x244280028440000ULL, 0x244280028400000ULL, 0x204280028040201ULL, 0x204280028000000ULL, 0x244280028040000ULL, 0x244280028000000ULL, 0x4280028440201ULL, 0x4280028400000ULL, 0x44280028440000ULL, 0x44280028400000ULL, 0x4280028040201ULL, 0x4280028000000ULL, 0x44280028040000ULL, 0x44280028000000ULL, 0x204280028440200ULL, 0x204280028400000ULL, 0x244280028440000ULL, 0x244280028400000ULL, 0x204280028040200ULL, 0x204280028000000ULL, 0x244280028040000ULL, 0x244280028000000ULL, 0x4280028440200ULL, 0x4280028400000ULL, 0x44280028440000ULL, 0x44280028400000ULL, 0x4280028040200ULL, 0x4280028000000ULL, 0x44280028040000ULL, 0x44280028000000ULL, 0x280028448201ULL, 0x280028408000ULL, 0x40280028448000ULL, 0x40280028408000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028448201ULL, 0x280028408000ULL, 0x40280028448000ULL, 0x40280028408000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028448200ULL, 0x280028408000ULL, 0x40280028448000ULL, 0x40280028408000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028448200ULL, 0x280028408000ULL, 0x40280028448000ULL, 0x40280028408000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028440201ULL, 0x280028400000ULL, 0x40280028440000ULL, 0x40280028400000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028440201ULL, 0x280028400000ULL, 0x40280028440000ULL, 0x40280028400000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028440200ULL, 0x280028400000ULL, 0x40280028440000ULL, 0x40280028400000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x280028440200ULL, 0x280028400000ULL, 0x40280028440000ULL, 0x40280028400000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x40280028040000ULL, 0x40280028000000ULL, 0x204280028448201ULL, 0x204280028408000ULL, 0x204280028448000ULL, 0x204280028408000ULL, 0x204280028040201ULL, 0x204280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x4280028448201ULL, 0x4280028408000ULL, 0x4280028448000ULL, 0x4280028408000ULL, 0x4280028040201ULL, 0x4280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x204280028448200ULL, 0x204280028408000ULL, 0x204280028448000ULL, 0x204280028408000ULL, 0x204280028040200ULL, 0x204280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x4280028448200ULL, 0x4280028408000ULL, 0x4280028448000ULL, 0x4280028408000ULL, 0x4280028040200ULL, 0x4280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x204280028440201ULL, 0x204280028400000ULL, 0x204280028440000ULL, 0x204280028400000ULL, 0x204280028040201ULL, 0x204280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x4280028440201ULL, 0x4280028400000ULL, 0x4280028440000ULL, 0x4280028400000ULL, 0x4280028040201ULL, 0x4280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x204280028440200ULL, 0x204280028400000ULL, 0x204280028440000ULL, 0x204280028400000ULL, 0x204280028040200ULL, 0x204280028000000ULL, 0x204280028040000ULL, 0x204280028000000ULL, 0x4280028440200ULL, 0x4280028400000ULL, 0x4280028440000ULL, 0x4280028400000ULL, 0x4280028040200ULL, 0x4280028000000ULL, 0x4280028040000ULL, 0x4280028000000ULL, 0x280028448201ULL, 0x280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028448201ULL, 0x280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028448200ULL, 0x280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028448200ULL, 0x280028408000ULL, 0x280028448000ULL, 0x280028408000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028440201ULL, 0x280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028440201ULL, 0x280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x280028040201ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028440200ULL, 0x280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x280028440200ULL, 0x280028400000ULL, 0x280028440000ULL, 0x280028400000ULL, 0x280028040200ULL, 0x280028000000ULL, 0x280028040000ULL, 0x280028000000ULL, 0x488500050880402ULL, 0x80500050080402ULL, 0x8500050000000ULL, 0x500050800000ULL, 0x488500050880400ULL, 0x80500050080400ULL, 0x408500050880402ULL, 0x500050080402ULL, 0x488500050800000ULL, 0x80500050000000ULL, 0x408500050880400ULL, 0x500050080400ULL, 0x488500050800000ULL, 0x80500050000000ULL, 0x408500050800000ULL, 0x500050000000ULL, 0x488500050880000ULL, 0x80500050080000ULL, 0x408500050800000ULL, 0x500050000000ULL, 0x488500050880000ULL, 0x80500050080000ULL, 0x408500050880000ULL, 0x500050080000ULL, 0x488500050800000ULL, 0x80500050000000ULL, 0x408500050880000ULL, 0x500050080000ULL, 0x488500050800000ULL, 0x80500050000000ULL, 0x408500050800000ULL, 0x500050000000ULL, 0x488500050080402ULL, 0x80500050880402ULL, 0x408500050800000ULL, 0x500050000000ULL, 0x488500050080400ULL, 0x80500050880400ULL, 0x408500050080402ULL, 0x500050880402ULL, 0x488500050000000ULL, 0x80500050800000ULL, 0x408500050080400ULL, 0x500050880400ULL, 0x488500050000000ULL, 0x80500050800000ULL, 0x408500050000000ULL, 0x500050800000ULL, 0x488500050080000ULL, 0x80500050880000ULL, 0x408500050000000ULL, 0x500050800000ULL, 0x488500050080000ULL, 0x80500050880000ULL, 0x408500050080000ULL, 0x500050880000ULL, 0x488500050000000ULL, 0x80500050800000ULL, 0x408500050080000ULL, 0x500050880000ULL, 0x488500050000000ULL, 0x80500050800000ULL, 0x408500050000000ULL, 0x500050800000ULL, 0x88500050880402ULL, 0x80500050080402ULL, 0x408500050000000ULL, 0x500050800000ULL, 0x88500050880400ULL, 0x80500050080400ULL, 0x8500050880402ULL, 0x500050080402ULL, 0x88500050800000ULL, 0x80500050000000ULL, 0x8500050880400ULL, 0x500050080400ULL, 0x88500050800000ULL, 0x80500050000000ULL, 0x8500050800000ULL, 0x500050000000ULL, 0x88500050880000ULL, 0x80500050080000ULL, 0x8500050800000ULL, 0x500050000000ULL, 0x88500050880000ULL, 0x80500050080000ULL, 0x8500050880000ULL, 0x500050080000ULL, 0x88500050800000ULL, 0x80500050000000ULL, 0x8500050880000ULL, 0x500050080000ULL, 0x88500050800000ULL, 0x80500050000000ULL, 0x8500050800000ULL, 0x500050000000ULL, 0x88500050080402ULL, 0x80500050880402ULL, 0x8500050800000ULL, 0x500050000000ULL, 0x88500050080400ULL, 0x80500050880400ULL, 0x8500050080402ULL, 0x500050880402ULL, 0x88500050000000ULL, 0x80500050800000ULL, 0x8500050080400ULL, 0x500050880400ULL, 0x88500050000000ULL, 0x80500050800000ULL, 0x8500050000000ULL, 0x500050800000ULL, 0x88500050080000ULL, 0x80500050880000ULL, 0x8500050000000ULL, 0x500050800000ULL, 0x88500050080000ULL, 0x80500050880000ULL, 0x8500050080000ULL, 0x500050880000ULL, 0x88500050000000ULL, 0x80500050800000ULL, 0x8500050080000ULL, 0x500050880000ULL, 0x88500050000000ULL, 0x80500050800000ULL, 0x8500050000000ULL, 0x500050800000ULL, 0x810a000a0100804ULL, 0x10a000a0100800ULL, 0x810a000a0100000ULL, 0x10a000a0100000ULL, 0x810a000a0000000ULL, 0x10a000a0000000ULL, 0x810a000a0000000ULL, 0x10a000a0000000ULL, 0xa000a0100804ULL, 0xa000a0100800ULL, 0xa000a0100000ULL, 0xa000a0100000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0x810a000a0100800ULL, 0x10a000a0100804ULL, 0x810a000a0100000ULL, 0x10a000a0100000ULL, 0x810a000a0000000ULL, 0x10a000a0000000ULL, 0x810a000a0000000ULL, 0x10a000a0000000ULL, 0xa000a0100800ULL, 0xa000a0100804ULL, 0xa000a0100000ULL, 0xa000a0100000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0xa000a0000000ULL, 0x1020400040201008ULL, 0x1020400040000000ULL, 0x20400040200000ULL, 0x20400040000000ULL, 0x400040201008ULL, 0x400040000000ULL, 0x400040200000ULL, 0x400040000000ULL, 0x1020400040201000ULL, 0x1020400040000000ULL, 0x20400040200000ULL, 0x20400040000000ULL, 0x400040201000ULL, 0x400040000000ULL, 0x400040200000ULL, 0x400040000000ULL, 0x20400040201008ULL, 0x20400040000000ULL, 0x1020400040200000ULL, 0x1020400040000000ULL, 0x400040201008ULL, 0x400040000000ULL, 0x400040200000ULL, 0x400040000000ULL, 0x20400040201000ULL, 0x20400040000000ULL, 0x1020400040200000ULL, 0x1020400040000000ULL, 0x400040201000ULL, 0x400040000000ULL, 0x400040200000ULL, 0x400040000000ULL, 0x402000204081020ULL, 0x402000204000000ULL, 0x402000204080000ULL, 0x402000204000000ULL, 0x2000204081000ULL, 0x2000204000000ULL, 0x2000204080000ULL, 0x2000204000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x402000204081000ULL, 0x402000204000000ULL, 0x402000204080000ULL, 0x402000204000000ULL, 0x2000204081020ULL, 0x2000204000000ULL, 0x2000204080000ULL, 0x2000204000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x402000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x2000200000000ULL, 0x805000508102040ULL, 0x5000508000000ULL, 0x805000508000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x5000508100000ULL, 0x805000508100000ULL, 0x5000508000000ULL, 0x805000508000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x805000508102000ULL, 0x5000508102040ULL, 0x805000508000000ULL, 0x5000508000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x805000508100000ULL, 0x5000508100000ULL, 0x805000508000000ULL, 0x5000508000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x805000500000000ULL, 0x5000500000000ULL, 0x5000508102000ULL, 0x110a000a11204080ULL, 0x10a000a11204080ULL, 0x110a000a11000000ULL, 0x10a000a11000000ULL, 0x100a000a10204080ULL, 0xa000a10204080ULL, 0x100a000a10000000ULL, 0xa000a10000000ULL, 0x110a000a11204000ULL, 0x10a000a11204000ULL, 0x110a000a11000000ULL, 0x10a000a11000000ULL, 0x100a000a10204000ULL, 0xa000a10204000ULL, 0x100a000a10000000ULL, 0xa000a10000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x110a000a11200000ULL, 0x10a000a11200000ULL, 0x110a000a11000000ULL, 0x10a000a11000000ULL, 0x100a000a10200000ULL, 0xa000a10200000ULL, 0x100a000a10000000ULL, 0xa000a10000000ULL, 0x110a000a11200000ULL, 0x10a000a11200000ULL, 0x110a000a11000000ULL, 0x10a000a11000000ULL, 0x100a000a10200000ULL, 0xa000a10200000ULL, 0x100a000a10000000ULL, 0xa000a10000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x110a000a01000000ULL, 0x10a000a01000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x100a000a00000000ULL, 0xa000a00000000ULL, 0x100a000a11204080ULL, 0xa000a11204080ULL, 0x100a000a11000000ULL, 0xa000a11000000ULL, 0x110a000a10204080ULL, 0x10a000a10204080ULL, 0x110a000a10000000ULL, 0x10a000a10000000ULL, 0x100a000a11204000ULL, 0xa000a11204000ULL, 0x100a000a11000000ULL, 0xa000a11000000ULL, 0x110a000a10204000ULL, 0x10a000a10204000ULL, 0x110a000a10000000ULL, 0x10a000a10000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x100a000a11200000ULL, 0xa000a11200000ULL, 0x100a000a11000000ULL, 0xa000a11000000ULL, 0x110a000a10200000ULL, 0x10a000a10200000ULL, 0x110a000a10000000ULL, 0x10a000a10000000ULL, 0x100a000a11200000ULL, 0xa000a11200000ULL, 0x100a000a11000000ULL, 0xa000a11000000ULL, 0x110a000a10200000ULL, 0x10a000a10200000ULL, 0x110a000a10000000ULL, 0x10a000a10000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x100a000a01000000ULL, 0xa000a01000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x110a000a00000000ULL, 0x10a000a00000000ULL, 0x2214001422418000ULL, 0x14001400000000ULL, 0x214001422408000ULL, 0x2014001400000000ULL, 0x2014001402010000ULL, 0x2214001420408000ULL, 0x14001402000000ULL, 0x214001420408000ULL, 0x2014001422410000ULL, 0x2014001400000000ULL, 0x14001422400000ULL, 0x14001400000000ULL, 0x214001402010000ULL, 0x2014001420400000ULL, 0x2214001402000000ULL, 0x14001420400000ULL, 0x2014001422010000ULL, 0x214001400000000ULL, 0x14001422000000ULL, 0x2214001400000000ULL, 0x2214001402010000ULL, 0x2014001420000000ULL, 0x214001402000000ULL, 0x14001420000000ULL, 0x2214001422410000ULL, 0x2214001400000000ULL, 0x214001422400000ULL, 0x214001400000000ULL, 0x2014001402010000ULL, 0x2214001420400000ULL, 0x14001402000000ULL, 0x214001420400000ULL, 0x2214001422010000ULL, 0x2014001400000000ULL, 0x214001422000000ULL, 0x14001400000000ULL, 0x2014001402010000ULL, 0x2214001420000000ULL, 0x14001402000000ULL, 0x214001420000000ULL, 0x2014001422010000ULL, 0x2014001400000000ULL, 0x14001422000000ULL, 0x14001400000000ULL, 0x2214001402010000ULL, 0x2014001420000000ULL, 0x214001402000000ULL, 0x14001420000000ULL, 0x14001422418000ULL, 0x2214001400000000ULL, 0x2014001422408000ULL, 0x214001400000000ULL, 0x2214001402010000ULL, 0x14001420408000ULL, 0x214001402000000ULL, 0x2014001420408000ULL, 0x2214001422010000ULL, 0x2214001400000000ULL, 0x214001422000000ULL, 0x214001400000000ULL, 0x2014001402010000ULL, 0x2214001420000000ULL, 0x14001402000000ULL, 0x214001420000000ULL, 0x214001422418000ULL, 0x2014001400000000ULL, 0x2214001422408000ULL, 0x14001400000000ULL, 0x14001402010000ULL, 0x214001420408000ULL, 0x2014001402000000ULL, 0x2214001420408000ULL, 0x14001422410000ULL, 0x14001400000000ULL, 0x2014001422400000ULL, 0x2014001400000000ULL, 0x2214001402010000ULL, 0x14001420400000ULL, 0x214001402000000ULL, 0x2014001420400000ULL, 0x14001422010000ULL, 0x2214001400000000ULL, 0x2014001422000000ULL, 0x214001400000000ULL, 0x214001402010000ULL, 0x14001420000000ULL, 0x2214001402000000ULL, 0x2014001420000000ULL, 0x214001422410000ULL, 0x214001400000000ULL, 0x2214001422400000ULL, 0x2214001400000000ULL, 0x14001402010000ULL, 0x214001420400000ULL, 0x2014001402000000ULL, 0x2214001420400000ULL, 0x214001422010000ULL, 0x14001400000000ULL, 0x2214001422000000ULL, 0x2014001400000000ULL, 0x14001402010000ULL, 0x214001420000000ULL, 0x2014001402000000ULL, 0x2214001420000000ULL, 0x14001422010000ULL, 0x14001400000000ULL, 0x2014001422000000ULL, 0x2014001400000000ULL, 0x214001402010000ULL, 0x14001420000000ULL, 0x2214001402000000ULL, 0x2014001420000000ULL, 0x2014001422418000ULL, 0x214001400000000ULL, 0x14001422408000ULL, 0x2214001400000000ULL, 0x214001402010000ULL, 0x2014001420408000ULL, 0x2214001402000000ULL, 0x14001420408000ULL, 0x214001422010000ULL, 0x214001400000000ULL, 0x2214001422000000ULL, 0x2214001400000000ULL, 0x14001402010000ULL, 0x214001420000000ULL, 0x2014001402000000ULL, 0x2214001420000000ULL, 0x4428002844820100ULL, 0x4428002844020100ULL, 0x428002844820100ULL, 0x428002844020100ULL, 0x4028002840800000ULL, 0x4028002840000000ULL, 0x28002840800000ULL, 0x28002840000000ULL, 0x4028002804000000ULL, 0x4028002804000000ULL, 0x28002804000000ULL, 0x28002804000000ULL, 0x4428002800000000ULL, 0x4428002800000000ULL, 0x428002800000000ULL, 0x428002800000000ULL, 0x4428002804020100ULL, 0x4428002804020100ULL, 0x428002804020100ULL, 0x428002804020100ULL, 0x4028002800000000ULL, 0x4028002800000000ULL, 0x28002800000000ULL, 0x28002800000000ULL, 0x4428002844820000ULL, 0x4428002844020000ULL, 0x428002844820000ULL, 0x428002844020000ULL, 0x4028002840800000ULL, 0x4028002840000000ULL, 0x28002840800000ULL, 0x28002840000000ULL, 0x4028002844820100ULL, 0x4028002844020100ULL, 0x28002844820100ULL, 0x28002844020100ULL, 0x4428002840800000ULL, 0x4428002840000000ULL, 0x428002840800000ULL, 0x428002840000000ULL, 0x4428002804020000ULL, 0x4428002804020000ULL, 0x428002804020000ULL, 0x428002804020000ULL, 0x4028002800000000ULL, 0x4028002800000000ULL, 0x28002800000000ULL, 0x28002800000000ULL, 0x4028002804020100ULL, 0x4028002804020100ULL, 0x28002804020100ULL, 0x28002804020100ULL, 0x4428002800000000ULL, 0x4428002800000000ULL, 0x428002800000000ULL, 0x428002800000000ULL, 0x4028002844820000ULL, 0x4028002844020000ULL, 0x28002844820000ULL, 0x28002844020000ULL, 0x4428002840800000ULL, 0x4428002840000000ULL, 0x428002840800000ULL, 0x428002840000000ULL, 0x4428002844800000ULL, 0x4428002844000000ULL, 0x428002844800000ULL, 0x428002844000000ULL, 0x4028002840800000ULL, 0x4028002840000000ULL, 0x28002840800000ULL, 0x28002840000000ULL, 0x4028002804020000ULL, 0x4028002804020000ULL, 0x28002804020000ULL, 0x28002804020000ULL, 0x4428002800000000ULL, 0x4428002800000000ULL, 0x428002800000000ULL, 0x428002800000000ULL, 0x4428002804000000ULL, 0x4428002804000000ULL, 0x428002804000000ULL, 0x428002804000000ULL, 0x4028002800000000ULL, 0x4028002800000000ULL, 0x28002800000000ULL, 0x28002800000000ULL, 0x4428002844800000ULL, 0x4428002844000000ULL, 0x428002844800000ULL, 0x428002844000000ULL, 0x4028002840800000ULL, 0x4028002840000000ULL, 0x28002840800000ULL, 0x28002840000000ULL, 0x4028002844800000ULL, 0x4028002844000000ULL, 0x28002844800000ULL, 0x28002844000000ULL, 0x4428002840800000ULL, 0x4428002840000000ULL, 0x428002840800000ULL, 0x428002840000000ULL, 0x4428002804000000ULL, 0x4428002804000000ULL, 0x428002804000000ULL, 0x428002804000000ULL, 0x4028002800000000ULL, 0x4028002800000000ULL, 0x28002800000000ULL, 0x28002800000000ULL, 0x4028002804000000ULL, 0x4028002804000000ULL, 0x28002804000000ULL, 0x28002804000000ULL, 0x4428002800000000ULL, 0x4428002800000000ULL, 0x428002800000000ULL, 0x428002800000000ULL, 0x4028002844800000ULL, 0x4028002844000000ULL, 0x28002844800000ULL, 0x28002844000000ULL, 0x4428002840800000ULL, 0x4428002840000000ULL, 0x428002840800000ULL, 0x428002840000000ULL, 0x8850005088040201ULL, 0x50005008000000ULL, 0x50005088000000ULL, 0x850005008000000ULL, 0x8850005080000000ULL, 0x50005000000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x8850005088040200ULL, 0x50005008000000ULL, 0x8850005088040000ULL, 0x50005008000000ULL, 0x8850005080000000ULL, 0x50005000000000ULL, 0x8850005080000000ULL, 0x50005000000000ULL, 0x8050005088040201ULL, 0x8850005008040201ULL, 0x8850005088040000ULL, 0x50005008000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8850005080000000ULL, 0x50005000000000ULL, 0x8050005088040200ULL, 0x8850005008040200ULL, 0x8050005088040000ULL, 0x8850005008040000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8850005088000000ULL, 0x8050005008040201ULL, 0x8050005088040000ULL, 0x8850005008040000ULL, 0x8850005080000000ULL, 0x8050005000000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8850005088000000ULL, 0x8050005008040200ULL, 0x8850005088000000ULL, 0x8050005008040000ULL, 0x8850005080000000ULL, 0x8050005000000000ULL, 0x8850005080000000ULL, 0x8050005000000000ULL, 0x8050005088000000ULL, 0x8850005008000000ULL, 0x8850005088000000ULL, 0x8050005008040000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8850005080000000ULL, 0x8050005000000000ULL, 0x8050005088000000ULL, 0x8850005008000000ULL, 0x8050005088000000ULL, 0x8850005008000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x850005088040201ULL, 0x8050005008000000ULL, 0x8050005088000000ULL, 0x8850005008000000ULL, 0x850005080000000ULL, 0x8050005000000000ULL, 0x8050005080000000ULL, 0x8850005000000000ULL, 0x850005088040200ULL, 0x8050005008000000ULL, 0x850005088040000ULL, 0x8050005008000000ULL, 0x850005080000000ULL, 0x8050005000000000ULL, 0x850005080000000ULL, 0x8050005000000000ULL, 0x50005088040201ULL, 0x850005008040201ULL, 0x850005088040000ULL, 0x8050005008000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x850005080000000ULL, 0x8050005000000000ULL, 0x50005088040200ULL, 0x850005008040200ULL, 0x50005088040000ULL, 0x850005008040000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x850005088000000ULL, 0x50005008040201ULL, 0x50005088040000ULL, 0x850005008040000ULL, 0x850005080000000ULL, 0x50005000000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x850005088000000ULL, 0x50005008040200ULL, 0x850005088000000ULL, 0x50005008040000ULL, 0x850005080000000ULL, 0x50005000000000ULL, 0x850005080000000ULL, 0x50005000000000ULL, 0x50005088000000ULL, 0x850005008000000ULL, 0x850005088000000ULL, 0x50005008040000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x850005080000000ULL, 0x50005000000000ULL, 0x50005088000000ULL, 0x850005008000000ULL, 0x50005088000000ULL, 0x850005008000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x50005080000000ULL, 0x850005000000000ULL, 0x10a000a010080402ULL, 0xa000a010080402ULL, 0x10a000a010080000ULL, 0xa000a010080000ULL, 0x10a000a010000000ULL, 0xa000a010000000ULL, 0x10a000a010000000ULL, 0xa000a010000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a010080400ULL, 0xa000a010080400ULL, 0x10a000a010080000ULL, 0xa000a010080000ULL, 0x10a000a010000000ULL, 0xa000a010000000ULL, 0x10a000a010000000ULL, 0xa000a010000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x10a000a000000000ULL, 0xa000a000000000ULL, 0x2040004020100804ULL, 0x2040004000000000ULL, 0x40004000000000ULL, 0x40004020000000ULL, 0x2040004020100000ULL, 0x2040004000000000ULL, 0x40004020100804ULL, 0x40004000000000ULL, 0x2040004000000000ULL, 0x2040004020100800ULL, 0x40004020100000ULL, 0x40004000000000ULL, 0x2040004000000000ULL, 0x2040004020100000ULL, 0x40004000000000ULL, 0x40004020100800ULL, 0x2040004020000000ULL, 0x2040004000000000ULL, 0x40004000000000ULL, 0x40004020100000ULL, 0x2040004020000000ULL, 0x2040004000000000ULL, 0x40004020000000ULL, 0x40004000000000ULL, 0x2040004000000000ULL, 0x2040004020000000ULL, 0x40004020000000ULL, 0x40004000000000ULL, 0x2040004000000000ULL, 0x2040004020000000ULL, 0x40004000000000ULL, 0x40004020000000ULL, 0x200020408102040ULL, 0x200020000000000ULL, 0x200020408000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020408100000ULL, 0x200020000000000ULL, 0x200020408000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020408102000ULL, 0x200020000000000ULL, 0x200020408000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020408100000ULL, 0x200020000000000ULL, 0x200020408000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x200020400000000ULL, 0x200020000000000ULL, 0x500050810204080ULL, 0x500050810204000ULL, 0x500050810200000ULL, 0x500050810200000ULL, 0x500050810000000ULL, 0x500050810000000ULL, 0x500050810000000ULL, 0x500050810000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050800000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0x500050000000000ULL, 0xa000a1120408000ULL, 0xa000a1120000000ULL, 0xa000a1020408000ULL, 0xa000a1020000000ULL, 0xa000a1100000000ULL, 0xa000a1100000000ULL, 0xa000a1000000000ULL, 0xa000a1000000000ULL, 0xa000a0100000000ULL, 0xa000a0100000000ULL, 0xa000a0000000000ULL, 0xa000a0000000000ULL, 0xa000a0100000000ULL, 0xa000a0100000000ULL, 0xa000a0000000000ULL, 0xa000a0000000000ULL, 0xa000a1100000000ULL, 0xa000a1100000000ULL, 0xa000a1000000000ULL, 0xa000a1000000000ULL, 0xa000a1120400000ULL, 0xa000a1120000000ULL, 0xa000a1020400000ULL, 0xa000a1020000000ULL, 0xa000a0100000000ULL, 0xa000a0100000000ULL, 0xa000a0000000000ULL, 0xa000a0000000000ULL, 0xa000a0100000000ULL, 0xa000a0100000000ULL, 0xa000a0000000000ULL, 0xa000a0000000000ULL, 0x1400142241800000ULL, 0x1400142201000000ULL, 0x1400142240800000ULL, 0x1400142200000000ULL, 0x1400142040800000ULL, 0x1400142000000000ULL, 0x1400142040800000ULL, 0x1400142000000000ULL, 0x1400142241000000ULL, 0x1400142201000000ULL, 0x1400142240000000ULL, 0x1400142200000000ULL, 0x1400142040000000ULL, 0x1400142000000000ULL, 0x1400142040000000ULL, 0x1400142000000000ULL, 0x1400140201000000ULL, 0x1400140201000000ULL, 0x1400140200000000ULL, 0x1400140200000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x1400140201000000ULL, 0x1400140201000000ULL, 0x1400140200000000ULL, 0x1400140200000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x1400140000000000ULL, 0x2800284482010000ULL, 0x2800284480000000ULL, 0x2800280000000000ULL, 0x2800280000000000ULL, 0x2800284482000000ULL, 0x2800284480000000ULL, 0x2800280000000000ULL, 0x2800280000000000ULL, 0x2800280402010000ULL, 0x2800280400000000ULL, 0x2800284080000000ULL, 0x2800284080000000ULL, 0x2800280402000000ULL, 0x2800280400000000ULL, 0x2800284080000000ULL, 0x2800284080000000ULL, 0x2800284402010000ULL, 0x2800284400000000ULL, 0x2800280000000000ULL, 0x2800280000000000ULL, 0x2800284402000000ULL, 0x2800284400000000ULL, 0x2800280000000000ULL, 0x2800280000000000ULL, 0x2800280402010000ULL, 0x2800280400000000ULL, 0x2800284000000000ULL, 0x2800284000000000ULL, 0x2800280402000000ULL, 0x2800280400000000ULL, 0x2800284000000000ULL, 0x2800284000000000ULL, 0x5000508804020100ULL, 0x5000508804020000ULL, 0x5000508000000000ULL, 0x5000508000000000ULL, 0x5000500000000000ULL, 0x5000500000000000ULL, 0x5000500800000000ULL, 0x5000500800000000ULL, 0x5000508800000000ULL, 0x5000508800000000ULL, 0x5000500000000000ULL, 0x5000500000000000ULL, 0x5000508000000000ULL, 0x5000508000000000ULL, 0x5000508804000000ULL, 0x5000508804000000ULL, 0x5000500804020100ULL, 0x5000500804020000ULL, 0x5000500000000000ULL, 0x5000500000000000ULL, 0x5000508000000000ULL, 0x5000508000000000ULL, 0x5000508800000000ULL, 0x5000508800000000ULL, 0x5000500800000000ULL, 0x5000500800000000ULL, 0x5000508000000000ULL, 0x5000508000000000ULL, 0x5000500000000000ULL, 0x5000500000000000ULL, 0x5000500804000000ULL, 0x5000500804000000ULL, 0xa000a01008040201ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008000000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008040000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008000000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008040200ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008000000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008040000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0xa000a01008000000ULL, 0xa000a00000000000ULL, 0xa000a01000000000ULL, 0xa000a00000000000ULL, 0x4000402010080402ULL, 0x4000402000000000ULL, 0x4000402010000000ULL, 0x4000402000000000ULL, 0x4000402010080400ULL, 0x4000402000000000ULL, 0x4000402010000000ULL, 0x4000402000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000402010080000ULL, 0x4000402000000000ULL, 0x4000402010000000ULL, 0x4000402000000000ULL, 0x4000402010080000ULL, 0x4000402000000000ULL, 0x4000402010000000ULL, 0x4000402000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x4000400000000000ULL, 0x2040810204080ULL, 0x2040810200000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040800000000ULL, 0x2040800000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040810000000ULL, 0x2040810000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040800000000ULL, 0x2040800000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040810204000ULL, 0x2040810200000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040800000000ULL, 0x2040800000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040810000000ULL, 0x2040810000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040800000000ULL, 0x2040800000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x2040000000000ULL, 0x2040000000000ULL, 0x2000000000000ULL, 0x2000000000000ULL, 0x5081020408000ULL, 0x5080000000000ULL, 0x5081020400000ULL, 0x5080000000000ULL, 0x5081000000000ULL, 0x5080000000000ULL, 0x5081000000000ULL, 0x5080000000000ULL, 0x5081020000000ULL, 0x5080000000000ULL, 0x5081020000000ULL, 0x5080000000000ULL, 0x5081000000000ULL, 0x5080000000000ULL, 0x5081000000000ULL, 0x5080000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0x5000000000000ULL, 0xa112040800000ULL, 0xa112040000000ULL, 0xa000000000000ULL, 0xa000000000000ULL, 0xa110000000000ULL, 0xa110000000000ULL, 0xa102040800000ULL, 0xa102040000000ULL, 0xa010000000000ULL, 0xa010000000000ULL, 0xa100000000000ULL, 0xa100000000000ULL, 0xa010000000000ULL, 0xa010000000000ULL, 0xa000000000000ULL, 0xa000000000000ULL, 0xa112000000000ULL, 0xa112000000000ULL, 0xa000000000000ULL, 0xa000000000000ULL, 0xa110000000000ULL, 0xa110000000000ULL, 0xa102000000000ULL, 0xa102000000000ULL, 0xa010000000000ULL, 0xa010000000000ULL, 0xa100000000000ULL, 0xa100000000000ULL, 0xa010000000000ULL, 0xa010000000000ULL, 0xa000000000000ULL, 0xa000000000000ULL, 0x14224180000000ULL, 0x14224080000000ULL, 0x14204080000000ULL, 0x14204080000000ULL, 0x14224100000000ULL, 0x14224000000000ULL, 0x14204000000000ULL, 0x14204000000000ULL, 0x14020100000000ULL, 0x14020000000000ULL, 0x14000000000000ULL, 0x14000000000000ULL, 0x14020100000000ULL, 0x14020000000000ULL, 0x14000000000000ULL, 0x14000000000000ULL, 0x14220100000000ULL, 0x14220000000000ULL, 0x14200000000000ULL, 0x14200000000000ULL, 0x14220100000000ULL, 0x14220000000000ULL, 0x14200000000000ULL, 0x14200000000000ULL, 0x14020100000000ULL, 0x14020000000000ULL, 0x14000000000000ULL, 0x14000000000000ULL, 0x14020100000000ULL, 0x14020000000000ULL, 0x14000000000000ULL, 0x14000000000000ULL, 0x28448201000000ULL, 0x28040200000000ULL, 0x28448000000000ULL, 0x28040000000000ULL, 0x28408000000000ULL, 0x28000000000000ULL, 0x28408000000000ULL, 0x28000000000000ULL, 0x28440201000000ULL, 0x28040200000000ULL, 0x28440000000000ULL, 0x28040000000000ULL, 0x28400000000000ULL, 0x28000000000000ULL, 0x28400000000000ULL, 0x28000000000000ULL, 0x28040201000000ULL, 0x28448200000000ULL, 0x28040000000000ULL, 0x28448000000000ULL, 0x28000000000000ULL, 0x28408000000000ULL, 0x28000000000000ULL, 0x28408000000000ULL, 0x28040201000000ULL, 0x28440200000000ULL, 0x28040000000000ULL, 0x28440000000000ULL, 0x28000000000000ULL, 0x28400000000000ULL, 0x28000000000000ULL, 0x28400000000000ULL, 0x50880402010000ULL, 0x50000000000000ULL, 0x50080000000000ULL, 0x50800000000000ULL, 0x50080400000000ULL, 0x50800000000000ULL, 0x50880000000000ULL, 0x50000000000000ULL, 0x50880400000000ULL, 0x50000000000000ULL, 0x50080000000000ULL, 0x50800000000000ULL, 0x50080402000000ULL, 0x50800000000000ULL, 0x50880000000000ULL, 0x50000000000000ULL, 0x50880400000000ULL, 0x50000000000000ULL, 0x50080000000000ULL, 0x50800000000000ULL, 0x50080402010000ULL, 0x50800000000000ULL, 0x50880000000000ULL, 0x50000000000000ULL, 0x50880402000000ULL, 0x50000000000000ULL, 0x50080000000000ULL, 0x50800000000000ULL, 0x50080400000000ULL, 0x50800000000000ULL, 0x50880000000000ULL, 0x50000000000000ULL, 0xa0100804020100ULL, 0xa0000000000000ULL, 0xa0100000000000ULL, 0xa0100800000000ULL, 0xa0100804000000ULL, 0xa0100000000000ULL, 0xa0100000000000ULL, 0xa0100800000000ULL, 0xa0000000000000ULL, 0xa0100000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0100804020000ULL, 0xa0000000000000ULL, 0xa0100000000000ULL, 0xa0100800000000ULL, 0xa0100804000000ULL, 0xa0100000000000ULL, 0xa0100000000000ULL, 0xa0100800000000ULL, 0xa0000000000000ULL, 0xa0100000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0xa0000000000000ULL, 0x40201008040201ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008000000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008040200ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008000000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008040000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008000000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008040000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40201008000000ULL, 0x40201000000000ULL, 0x40200000000000ULL, 0x40200000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, 0x40000000000000ULL, };
-
-constexpr uint64_t MAGIC_BISHOP_NUMBER[64] = {
-0x40020c0118010300ULL, 0x1e3001120882052eULL, 0x1404080083000004ULL, 0x5c4100a0000100ULL, 0x80041421002802c1ULL, 0x1048282848000100ULL, 0x804020802480902ULL, 0xc200442034aaULL, 0x504a60040a8210ULL, 0x28820810040880a0ULL, 0x2004900c84810122ULL, 0x48110400800011ULL, 0xc0204d1040000000ULL, 0x810006022221c044ULL, 0x80b0090900800ULL, 0x10010242100c00ULL, 0x20001202100101ULL, 0x206051030c040088ULL, 0x80900c0884620120ULL, 0x8000082004400ULL, 0x1c0900404201040ULL, 0x1000201a10100820ULL, 0x225020448061060ULL, 0x2000820100481280ULL, 0x420645920440480ULL, 0x80a000c100201ULL, 0x1004620004040400ULL, 0x2242008048008022ULL, 0x4011004014004041ULL, 0x2100c0810820100ULL, 0x208230204434800ULL, 0x1aa0000210c00ULL, 0x1104000502408ULL, 0x8028021000080308ULL, 0x200211000010408ULL, 0x1010181800020a00ULL, 0x404104011040100ULL, 0x20204010084300cULL, 0x20102931004208a4ULL, 0x2014048832008401ULL, 0x8420220065000ULL, 0x880bd40218022034ULL, 0x20420044014048ULL, 0x401100c202803804ULL, 0x8000982009000822ULL, 0xa808050800882200ULL, 0x1120222202000040ULL, 0x8092204010288d0ULL, 0x4084040a08042810ULL, 0x340020821010a018ULL, 0x10020a8068080104ULL, 0xa890400108480010ULL, 0x801410020a0024ULL, 0x10041c48060001ULL, 0x41100401004000ULL, 0x8102100550203ULL, 0xb2002402080509ULL, 0x4222012048ULL, 0x1001000242a1800ULL, 0x82021080840401ULL, 0x2800180044850406ULL, 0x830000e0a1061a80ULL, 0x8400c04803410210ULL, 0x20200c00444040ULL, };
-
-constexpr uint64_t BISHOP_ATTACK_OFFSET[64] = {
-0x0ULL, 0x40ULL, 0x60ULL, 0x80ULL, 0xa0ULL, 0xc0ULL, 0xe0ULL, 0x100ULL, 0x140ULL, 0x160ULL, 0x180ULL, 0x1a0ULL, 0x1c0ULL, 0x1e0ULL, 0x200ULL, 0x220ULL, 0x240ULL, 0x260ULL, 0x280ULL, 0x300ULL, 0x380ULL, 0x400ULL, 0x480ULL, 0x4a0ULL, 0x4c0ULL, 0x4e0ULL, 0x500ULL, 0x580ULL, 0x780ULL, 0x980ULL, 0xa00ULL, 0xa20ULL, 0xa40ULL, 0xa60ULL, 0xa80ULL, 0xb00ULL, 0xd00ULL, 0xf00ULL, 0xf80ULL, 0xfa0ULL, 0xfc0ULL, 0xfe0ULL, 0x1000ULL, 0x1080ULL, 0x1100ULL, 0x1180ULL, 0x1200ULL, 0x1220ULL, 0x1240ULL, 0x1260ULL, 0x1280ULL, 0x12a0ULL, 0x12c0ULL, 0x12e0ULL, 0x1300ULL, 0x1320ULL, 0x1340ULL, 0x1380ULL, 0x13a0ULL, 0x13c0ULL, 0x13e0ULL, 0x1400ULL, 0x1420ULL, 0x1440ULL, };
-
-
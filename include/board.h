@@ -1,11 +1,13 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include "constants.h"
 #include <cstdint>
 #include "Move.h"
 #include <array>
 #include "utils.h"
+#include "nnue.h"
 
 //helper Structs
 struct PositionalScore {
@@ -20,94 +22,48 @@ struct CheckInfo{
     int count;
     int attacker_square;
 };
+// Squares from which each piece type of the side to move would attack the enemy king,
+// plus own pieces whose departure uncovers a slider onto that king.
+struct CheckSquares {
+    std::array<uint64_t, 6> squares;
+    uint64_t discovered_blockers;
+    int king_square;
+};
+
+// Result of Board::set_fen; names the first FEN field that failed to parse.
+enum class FenError : uint8_t { None, Pieces, Kings, Turn, Castling, EnPassant, Counters };
 
 #include <unordered_map>
 #include <cstdint>
 #include <vector>
 
+// Repetition bookkeeping for the current position. The counts are derived in make_move by
+// scanning the reversible part of the history backwards two plies at a time and are
+// restored from BoardState on undo, so no lookup ever touches more than the current window.
 struct RepetitionTracker {
-    static constexpr int CAP = 600;
-    std::array<uint64_t, CAP> keys{};
-	std::array<uint8_t, CAP> vals{};
-	uint16_t current_start = 0;
-    uint16_t current_end = 0;
-    uint8_t current_twofold_positions = 0;
-
-    void clear(){
-        current_start = 0;
-        current_end = 0;
-		current_twofold_positions = 0;
-	}
-    void reset_boundaries(int new_start,int new_current_twofold) {
-        current_end = current_start;
-        current_start = new_start;
-        current_twofold_positions = new_current_twofold;
-	}
-    uint8_t count(uint64_t h) const {
-        for (int i = current_start; i != current_end; i++) {
-            if (keys[i] == h) {
-                return vals[i];
-            }
-        }
-        return 0;
-	}
-    bool has_any_twofold() const {
-        return current_twofold_positions > 0;
-	}
-    bool has_any_threefold() const {
-        for (int i = current_start; i != current_end; i++) {
-            if (vals[i] >= 3) return true;
-        }
-        return false;
+    uint8_t current_count = 1;          // occurrences of the current position, capped at 3
+    uint8_t twofold_positions = 0;      // positions in the window seen at least twice
+    uint8_t threefold_positions = 0;    // positions in the window seen at least three times
+
+    void clear() {
+        current_count = 1;
+        twofold_positions = 0;
+        threefold_positions = 0;
     }
-    void push(uint64_t h) {
-        // find existing
-        for(int i=current_start;i!=current_end;++i){
-            if (keys[i]==h){
-                if (vals[i]==1) current_twofold_positions++;
-                vals[i]++;
-                return;
-            }
-        }
-        keys[current_end] = h;
-        vals[current_end] = 1;
-        current_end++;
+    uint8_t count() const {
+        return current_count;
     }
-    void pop(uint64_t h) {
-        for (int i = current_start; i != current_end; i++) {
-            if (keys[i] == h) {
-                if (vals[i] == 2) current_twofold_positions--;
-                if (--vals[i] == 0) {
-                    // Remove entry by swapping with last
-                    keys[i] = keys[current_end - 1];
-                    vals[i] = vals[current_end - 1];
-                    current_end--;
-                }
-                return;
-            }
-        }
-		throw std::runtime_error("Hash not found in repetition tracker during pop");
-	}
-    void recover_from_old(uint64_t h,int old_start, int old_twofold) {
-        pop(h);
-        current_start = old_start;
-        current_twofold_positions = old_twofold;
-
-    }
-    uint16_t get_start() const {
-        return current_start;
+    bool has_any_twofold() const {
+        return twofold_positions > 0;
     }
-    uint16_t get_end() const {
-        return current_end;
+    bool has_any_threefold() const {
+        return threefold_positions > 0;
     }
-    uint8_t get_twofold() const {
-        return current_twofold_positions;
+    void record(uint8_t new_count) {
+        current_count = new_count;
+        if (new_count == 2) twofold_positions++;
+        if (new_count == 3) threefold_positions++;
     }
-    void reset(uint64_t h) {
-		current_start = current_end;
-		current_twofold_positions = 0;
-        push(h);
-	}
 };
 struct BoardState {
     // 1. Largest Types First (8-byte aligned)
@@ -116,6 +72,7 @@ struct BoardState {
     uint64_t all_pieces;                           // 8 bytes
     uint64_t zobrist_hash;                         // 8 bytes
     uint64_t pawn_key;                             // 8 bytes
+    uint64_t material_key;                         // 8 bytes
 
     // 2. Medium Types (Size depends on your implementation, usually 2 to 4 bytes)
 	EvaluationResult positional_score;             // 4 bytes
@@ -128,16 +85,18 @@ struct BoardState {
     uint64_t black_king_square : 6;
     uint64_t en_passant_square : 7;
     uint64_t castling_rights : 4;
-    uint64_t current_twofold_count : 6;
+    uint64_t repetition_count : 4;
     uint64_t half_moves : 10;
     uint64_t move_count : 9;
-    uint64_t current_repetition_tracker_start : 10;
+    uint64_t twofold_positions : 6;
+    uint64_t threefold_positions : 6;
 };
 // Board class
 class Board{
     public:
 		// Constructor and Setup 
         Board(const std::string& fen=STARTING_FEN);
+        FenError set_fen(std::string_view fen);
         void display() const;
 		void reserve_history(size_t size);
         Board(const Board& other);
@@ -190,6 +149,16 @@ class Board{
         int get_game_phase() const;
 		int get_king_square(Color color) const;
         bool in_check() const;
+        bool gives_check(const Move& move) const;
+        const CheckSquares& get_check_squares() const;
+        // Accumulator of the current position, or nullptr when the network was not loaded at set_fen
+        const nnue::Accumulator* get_accumulator() const {
+            return accumulators.empty() ? nullptr : &accumulators.back();
+        }
+        // Rebuilds the accumulator stack for the current position (or drops it when NNUE is off)
+        void refresh_accumulators();
+        // For boards that are never evaluated (perft): make_move then skips the network updates
+        void drop_accumulators() { accumulators.clear(); }
         BoardState get_board_state() const;
 		void push_current_state_to_history();
         bool is_repetition_draw(int repeat=3) const;
@@ -197,15 +166,19 @@ class Board{
 		bool any_appeared_more_than(int count) const;
 		uint64_t get_zobrist_hash() const;
         uint64_t get_pawn_key() const;
+        uint64_t get_material_key() const;
 		bool is_free_file(const int square, const Color pawn_color) const;
 		// Advanced Search Helpers
         CheckInfo count_attacker_on_square(const int square,const Color attacker_color,const int bound=2, const bool need_sq=true) const;
         bool has_enough_material_for_nmp() const;
         //other
+        // Recomputes the keys and incremental scores from the bitboards; returns the name of the first one that disagrees, or nullptr
+        const char* find_incremental_mismatch() const;
     private:
 		// Member Variables
         uint64_t zobrist_hash;
         uint64_t pawn_key;
+        uint64_t material_key;
         uint8_t castling_rights;
         int en_passant_square;
         int game_phase;
@@ -226,6 +199,12 @@ class Board{
         int move_count;
         std::vector<BoardState> history;
 		RepetitionTracker repetition_tracker;
+        // One entry per ply alongside history while NNUE is enabled; make_move pushes, undo_move pops
+        std::vector<nnue::Accumulator> accumulators;
+        // Lazily filled by get_check_squares(), valid while the hash matches
+        mutable CheckSquares check_squares{};
+        mutable uint64_t check_squares_key = 0;
+        mutable bool check_squares_valid = false;
 		// Private Helper Methods
 
 		// Initialization Helpers
@@ -233,30 +212,28 @@ class Board{
         void initialize_game_phase();
         uint64_t initialize_hash() const;
 		uint64_t initialize_pawn_key() const;
+        uint64_t initialize_material_key() const;
         EvaluationResult initialize_material_score() const;
         EvaluationResult initialize_positional_score() const;
         void debug_check_pawn_key() const;
-
-		// FEN Parsing Helpers
-        void parse_fen(const std::string& fen);
-        void parse_fen_pieces(const std:: string& piece_data);
-        void parse_fen_turn(const std:: string& turn_data);
-        void parse_fen_castling(const std::string& castling_data);
-        void parse_fen_en_passant(const std::string& en_passant_data);
-        void parse_fen_half_move(const std::string& half_move_data);
-        void parse_fen_move(const std::string& half_move_data);
+        void compute_check_squares() const;
+        uint64_t get_slider_blockers(int king_square, Color blocker_color, Color slider_color) const;
 
 		//Inceremental Update Helpers
-        void update_pieces(const Move& move);
+        template <Color Us> void make_move_for(const Move& move);
+        template <Color Us> void update_pieces(const Move& move);
+        template <Color Us> void update_accumulator(const Move& move);
         void update_turn_rights(const Move& move);
-        void update_castle_rights(const Move& move);
-        void update_en_passsant_rights(const Move& move);
-        void update_pieces_hash(const Move& move);
-        void update_material_score(const Move& move);
-        void update_positional_score(const Move& move);
+        template <Color Us> void update_castle_rights(const Move& move);
+        template <Color Us> void update_en_passsant_rights(const Move& move);
+        template <Color Us> void update_pieces_hash(const Move& move);
+        template <Color Us> void update_material_key(const Move& move);
+        template <Color Us> void update_material_score(const Move& move);
+        template <Color Us> void update_positional_score(const Move& move);
         void update_game_phase(const Move& move);
-		void update_king_square(const Move& move);
+		template <Color Us> void update_king_square(const Move& move);
         void recover_board_state(const BoardState& previous_state);
 		void update_move_count(const Move& move);
         void update_repetition_tracker();
+        uint8_t count_repetitions() const;
 };
\ No newline at end of file
@@ -9,6 +9,8 @@
     #define DEFAULT_TT_MB 128  // fallback if not set by CMake
 #endif
 constexpr size_t MAX_MEMORY_TT_MB = DEFAULT_TT_MB; // in MB
+constexpr size_t PERFT_HASH_MB = 64; // subtree counts shared by the perft threads
+constexpr size_t DEFAULT_PAWN_HASH_MB = 2; // per search thread
 
 //color and piece constants
 enum class Color: uint8_t { WHITE, BLACK, NONE };
@@ -0,0 +1,28 @@
+#pragma once
+#include <cstdint>
+#include "board.h"
+
+// Specialised endgame knowledge, looked up once per material configuration when the material
+// table builds an entry. A value function replaces evaluate() outright and is white-relative;
+// a scale function returns how much of the endgame score the stronger side keeps, out of
+// SCALE_NORMAL, for material that is known to be drawish.
+using EndgameEvalFn = int (*)(const Board& board);
+using EndgameScaleFn = int (*)(const Board& board);
+
+namespace endgame {
+    // Won but not mate: stays below MATE_THRESHOLD and inside the int16 eval cache
+    constexpr int KNOWN_WIN = 10000;
+    constexpr int SCALE_NORMAL = 64;
+    constexpr int SCALE_DRAW = 0;
+
+    struct Functions {
+        EndgameEvalFn value = nullptr;
+        EndgameScaleFn scale[2] = { nullptr, nullptr }; // [stronger side]
+    };
+    // Material key of a signature such as "KBNK": the strong side's pieces, then the weak side's
+    uint64_t material_key(const char* code, Color strong);
+    // King and one pawn against a bare king, either colour; these evaluate exactly via the KPK bitbase
+    bool is_kpk(const Board& board);
+    // Exact signatures first, then the generic rules (KXK, insufficient material, drawish scaling)
+    Functions lookup(const Board& board);
+}
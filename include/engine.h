@@ -75,6 +75,16 @@ struct PerftRes {
     double duration;
     uint64_t nodes;
 };
+struct PerftDivide {
+    Move move;
+    uint64_t nodes;
+};
+// Lockless perft hash slot: check holds key ^ data, so a torn write never validates.
+// data packs the subtree count above the 8-bit depth.
+struct PerftEntry {
+    uint64_t check = 0;
+    uint64_t data = 0;
+};
 struct SearchLimits {
     int depth = -1;
     int movetime = -1;
@@ -120,9 +130,11 @@ class Engine {
 		Engine(size_t tt_size_mb = MAX_MEMORY_TT_MB);
         void set_threads(int n);
 		void resize_tt(size_t tt_size_mb);
+        void resize_pawn_hash(size_t pawn_hash_mb);
     ~Engine();
         void shutdown();
         PerftRes perft_test(Board& board, int depth);
+        PerftRes perft(const Board& position, int depth, std::vector<PerftDivide>* divide = nullptr);
         int checks_count;
         int ep_count;
         int capture_count;
@@ -158,6 +170,26 @@ class Engine {
         Board job_position;
 		SearchLimits job_limits;
 
+        enum class JobType { Search, Perft };
+        JobType job_type = JobType::Search;
+        // Perft work items: one root move, optionally followed by one reply when the root is split a ply deeper
+        struct PerftTask {
+            int root_index;
+            Move first;
+            Move second;
+            bool has_second;
+            uint64_t nodes;
+        };
+        std::vector<PerftTask> perft_tasks;
+        std::atomic<size_t> perft_next_task{ 0 };
+        int perft_task_depth = 0;
+        std::vector<PerftEntry> perft_hash;
+        // Folded into every perft hash key and bumped per run, so entries from earlier runs never validate
+        uint64_t perft_generation = 0;
+        void run_perft_tasks(const Board& position, ThreadLocalData* tls);
+        bool probe_perft(uint64_t hash, int depth, uint64_t& out_nodes);
+        void store_perft(uint64_t hash, int depth, uint64_t nodes);
+
         SearchResult negamax(Board & board, int depth, int alpha, int beta, int ply,ThreadLocalData* tls);
         int quiescence_search(Board& board, int alpha, int beta, int ply, ThreadLocalData* tls);
         Move best_move_this_iteration;
@@ -168,12 +200,12 @@ class Engine {
         std::chrono::duration<double> time_limit;
         void sort_moves(MoveList& moves, const Board& board, int ply,const Move& tt_move, bool tt_depth_0 = false,ThreadLocalData* tls={});
         int score_move(const Move& move, int ply,const Move& tt_move, bool depth_0,const Board& board,ThreadLocalData* tls);
-        uint64_t perft_driver(Board& board, int depth, int orignal_depth);
+        uint64_t perft_driver(Board& board, int depth, int ply, ThreadLocalData* tls);
         TimeControlDecision decide_time_control(const Board& position, const SearchLimits& limits);
         bool probe_tt(uint64_t hash, int depth, int alpha, int beta, int& out_score, Move& out_move, bool is_depth_0 = false, TTMode mode = TTMode::Negamax);
         bool store_tt(uint64_t hash, int depth, int original_alpha, int beta, int best_score, Move& best_move,bool is_best_tempered,bool is_any_tempered = false, TTMode mode = TTMode::Negamax);
-		bool should_futility_prune(int depth, int eval, int alpha, bool in_check,const Move& move);
-		int late_move_reduction(int depth, int moves_searched, const Move& move, int ply, ThreadLocalData* tls);
+		bool should_futility_prune(int depth, int eval, int alpha, bool in_check, bool gives_check,const Move& move);
+		int late_move_reduction(int depth, int moves_searched, const Move& move, bool gives_check, int ply, ThreadLocalData* tls);
 		bool try_null_move_pruning(Board& board,bool is_in_check, int depth, int alpha, int beta, int ply, int& out_score,ThreadLocalData* tls);
 		SearchResult terminal_eval(const Board& board, bool king_is_in_check,int ply);
 		void update_history_killer(const Move& move, int depth, int ply,ThreadLocalData* tls);
@@ -0,0 +1,25 @@
+#pragma once
+#include <ostream>
+
+// Evaluation term distributions, compiled in only with the ENGINE_STATS CMake option.
+// Every evaluation records each term's tapered, white-relative value into a per-thread histogram;
+// the UCI "evalstats" command prints them. Without ENGINE_STATS the recording calls in
+// evaluation.cpp are preprocessed out, so release builds pay nothing.
+namespace eval_stats {
+    enum class Term : int {
+        Material, Positional, PawnStructure, Imbalance, KingSafety, Mobility,
+        RookActivity, BadBishop, Fianchetto, TrappedMinors, Outpost, Total,
+        Count
+    };
+    constexpr int TERM_COUNT = static_cast<int>(Term::Count);
+    // Centipawn buckets of BUCKET_WIDTH covering [-HISTOGRAM_RANGE, HISTOGRAM_RANGE); outliers go to the edge buckets
+    constexpr int HISTOGRAM_RANGE = 1024;
+    constexpr int BUCKET_WIDTH = 16;
+    constexpr int BUCKET_COUNT = 2 * HISTOGRAM_RANGE / BUCKET_WIDTH;
+#ifdef ENGINE_STATS
+    void record(Term term, int value);
+    // Merges every thread's histograms; call only while no search is running
+    void dump(std::ostream& out);
+    void reset();
+#endif
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "board.h"
+#include "endgame.h"
 struct KingSafetyScore {
     int mg_score;
     int eg_score;
@@ -8,18 +9,35 @@ struct PawnStructureScore {
 	int mg_score;
 	int eg_score;
 };
-struct PawnEvalEntry {
+// One cache line per entry: the pawn terms are stored as their sum, the only thing evaluate reads
+struct alignas(64) PawnEvalEntry {
 		uint64_t key;
-		EvaluationResult doubled_score;
-		EvaluationResult isolated_passed_score;
-		EvaluationResult backward_score;
 		uint64_t isolated_pawns[2] = { 0,0 };
 		uint64_t passed_pawns[2] = { 0,0 };
 		uint64_t backward_pawns[2] = { 0,0 };
+		EvaluationResult score;
 		bool valid;
 };
+static_assert(sizeof(PawnEvalEntry) == 64, "PawnEvalEntry must fit one cache line");
 
-constexpr int PAWN_HASH_SIZE = 1 << 18;
+// Per-thread pawn hash size in MB, rounded down to a power-of-two entry count. Applies to tables
+// allocated after the call; Engine::resize_pawn_hash restarts the pool so every thread picks it up.
+void set_pawn_hash_size(size_t size_mb);
+// Allocates the calling thread's evaluation tables; search threads call it when they start so
+// the first evaluation mid-search does not pay for the allocation
+void init_thread_eval_tables();
+
+// Everything that depends only on the piece counts, keyed by Board::get_material_key().
+struct MaterialEntry {
+		uint64_t key;
+		EvaluationResult imbalance;
+		EndgameEvalFn endgame_eval = nullptr;
+		EndgameScaleFn endgame_scale[2] = { nullptr, nullptr };
+		uint8_t game_phase;
+		bool valid;
+};
+constexpr int MATERIAL_HASH_SIZE = 1 << 13;
+constexpr int EVAL_CACHE_SIZE = 1 << 16;
 enum EvalTerms : uint8_t {
 	EVAL_MATERIAL = 1<<0,
 	EVAL_POSITIONAL = 1 << 1,
@@ -29,9 +47,37 @@ enum EvalTerms : uint8_t {
 	EVAL_ROOK_ACTIVITY = 1 << 5,
 	EVAL_MINOR_PIECES = 1 << 6,
 
-	EvalAll = EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE | EVAL_KING_SAFETY | EVAL_MOBILITY | EVAL_ROOK_ACTIVITY | EVAL_MINOR_PIECES
+	EvalAll = EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE | EVAL_KING_SAFETY | EVAL_MOBILITY | EVAL_ROOK_ACTIVITY | EVAL_MINOR_PIECES,
+	// Incremental and hashed terms only; the static eval behind futility pruning and RFP
+	EvalCheap = EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE
+};
+// White-relative evaluation of the selected terms; unselected terms are compiled out.
+// Instantiated in evaluation.cpp for EvalAll and EvalCheap only.
+template <uint8_t Terms = EvalAll>
+int evaluate(const Board& board);
+extern template int evaluate<EvalAll>(const Board& board);
+extern template int evaluate<EvalCheap>(const Board& board);
+// Lazy variant for a side-to-move relative window: when material, PST and pawns alone are
+// LAZY_EVAL_MARGIN outside [alpha, beta] that partial score is returned. Side-to-move relative.
+// The margin is a heuristic, so the partial score can differ from the full one by more than it,
+// and a rare early exit lands on the wrong side of the window.
+int evaluate(const Board& board, int alpha, int beta);
+struct EvalStats {
+    uint64_t lazy_calls;
+    uint64_t lazy_early_exits;
+    uint64_t cache_probes;
+    uint64_t cache_hits;
+    uint64_t pawn_probes;
+    uint64_t pawn_hits;
 };
-int evaluate(const Board& board,uint8_t terms_mask=EvalAll);
+// Totals since the last reset; each thread publishes its counts every 1024 cache probes and
+// when it calls flush_eval_stats, which every search thread does at the end of its job
+EvalStats get_eval_stats();
+void flush_eval_stats();
+// Clears the totals and the calling thread's pending counts; the other threads have none between jobs
+void reset_eval_stats();
+// Retires every thread's cached evaluations; call when the evaluation function itself changes
+void invalidate_eval_caches();
 struct EvalContext {
     const Board& board;
 	const std::array<std::array<uint64_t,6>,2> pieces;
@@ -48,7 +94,13 @@ struct EvalContext {
     uint64_t backward_pawns[2];
     uint64_t isolated_pawns[2];
     uint64_t passed_pawns[2];
+    // Attack maps, filled once per evaluation by compute_attack_maps() before the piece terms run.
+    // attacked_by[color][piece type].
+    uint64_t attacked_by[2][6];
+    // Sum over each piece type of popcount(attacks & ~own pieces), the mobility term's input
+    int mobility_count[2][6];
 
     // Konstruktor-Deklaration (Implementation bleibt in .cpp)
     EvalContext(const Board& b);
+    void compute_attack_maps();
 };
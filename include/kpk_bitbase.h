@@ -0,0 +1,24 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include "constants.h"
+
+// King and pawn against king, solved exactly. init() builds one win/draw bit per position (24 KB)
+// by retrograde analysis over KING_ATTACKS and PAWN_ATTACKS, splitting every pass across a few threads.
+namespace kpk {
+    // Builds the bitbase on the first call and returns at once after that; the Engine constructor
+    // calls it, so anything that evaluates outside an Engine must call it before probing
+    void init();
+    // Squares are absolute; any colour may hold the pawn and any side may be to move
+    bool probe(Color strong, int strong_king, int pawn, int weak_king, Color side_to_move);
+
+    struct BitbaseStats {
+        size_t positions;
+        size_t bytes;
+        int threads;
+        int passes;
+        double build_ms;
+    };
+    // All zero until init() has run
+    const BitbaseStats& get_bitbase_stats();
+}
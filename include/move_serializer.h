@@ -0,0 +1,108 @@
+#pragma once
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include "Move.h"
+#include "utils.h"
+#if (defined(__AVX512VBMI2__) && defined(__AVX512BW__)) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+// Batched bitboard-to-move serialisation.
+// A Move is eight bytes and the moves produced from one (from square, target set) pair differ only
+// in to_square, so the generators build one template move and stamp the target squares into it.
+// Dense target sets take a vector path: AVX-512 VBMI2 compresses the square indices in one
+// instruction, plain AVX2 looks up the set bits of each byte in a table. The AVX2 path writes
+// whole blocks of four, so it may write up to 3 moves past the new end of the list; MoveList has
+// room for 256 moves and no position has more than 218 legal ones.
+
+static_assert(sizeof(Move) == 8, "the batched serialiser writes Move as a 64-bit word");
+
+namespace move_serializer_detail {
+    constexpr int TO_SQUARE_SHIFT = int(offsetof(Move, to_square)) * 8;
+
+    inline uint64_t pack(const Move& move) {
+        return std::bit_cast<uint64_t>(move);
+    }
+
+    constexpr int VECTOR_SERIALIZE_MIN_TARGETS = 8;
+
+    // The indices of the set bits of every byte value, packed one per byte from the lowest
+    constexpr auto make_byte_bit_indices() {
+        struct Table { uint64_t indices[256]; } table{};
+        for (int bits = 0; bits < 256; ++bits) {
+            int slot = 0;
+            for (int bit = 0; bit < 8; ++bit) {
+                if (bits & (1 << bit)) table.indices[bits] |= uint64_t(bit) << (8 * slot++);
+            }
+        }
+        return table;
+    }
+    inline constexpr auto BYTE_BIT_INDICES = make_byte_bit_indices();
+}
+
+// Appends one copy of base per set bit of targets, with to_square set to that bit
+inline void serialize_targets(MoveList& moves, const Move& base, uint64_t targets) {
+    using namespace move_serializer_detail;
+    if constexpr (std::endian::native != std::endian::little) {
+        while (targets) {
+            Move move = base;
+            move.to_square = get_lsb(targets);
+            moves.push_back(move);
+            targets &= targets - 1;
+        }
+        return;
+    }
+    uint64_t packed_base = pack(base) & ~(uint64_t(0xFF) << TO_SQUARE_SHIFT);
+    Move* out = moves.moves + moves.count;
+    int count = popcount(targets);
+#if defined(__AVX512VBMI2__) && defined(__AVX512BW__)
+    // Dense sets (open queens and rooks): compress the selected square indices into the low bytes,
+    // then widen them eight at a time. Below the threshold the fixed cost outweighs the scalar loop.
+    if (count >= VECTOR_SERIALIZE_MIN_TARGETS) {
+        alignas(64) static constexpr uint8_t SQUARE_INDICES[64] = {
+             0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+            32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+            48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63 };
+        alignas(64) uint8_t squares[64];
+        _mm512_store_si512(squares, _mm512_maskz_compress_epi8(targets, _mm512_load_si512(SQUARE_INDICES)));
+        const __m512i base_vector = _mm512_set1_epi64(int64_t(packed_base));
+        // Zero-masked forms throughout: the unmasked widen and shift merge into an undefined vector,
+        // which GCC reports as maybe-uninitialized. The store mask stops at the last move.
+        for (int i = 0; i < count; i += 8) {
+            const __mmask8 lanes = count - i >= 8 ? __mmask8(0xFF) : __mmask8((1u << (count - i)) - 1);
+            __m512i to = _mm512_maskz_cvtepu8_epi64(lanes, _mm_loadl_epi64(reinterpret_cast<const __m128i*>(squares + i)));
+            to = _mm512_maskz_slli_epi64(lanes, to, TO_SQUARE_SHIFT);
+            _mm512_mask_storeu_epi64(out + i, lanes, _mm512_or_si512(base_vector, to));
+        }
+        moves.count += count;
+        return;
+    }
+#elif defined(__AVX2__)
+    if (count >= VECTOR_SERIALIZE_MIN_TARGETS) {
+        const __m256i base_vector = _mm256_set1_epi64x(int64_t(packed_base));
+        int written = 0;
+        for (int shift = 0; shift < 64; shift += 8) {
+            unsigned bits = unsigned(targets >> shift) & 0xFF;
+            if (!bits) continue;
+            __m128i squares = _mm_add_epi8(_mm_cvtsi64_si128(int64_t(BYTE_BIT_INDICES.indices[bits])), _mm_set1_epi8(char(shift)));
+            __m256i low = _mm256_slli_epi64(_mm256_cvtepu8_epi64(squares), TO_SQUARE_SHIFT);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written), _mm256_or_si256(base_vector, low));
+            int byte_count = popcount(uint64_t(bits));
+            if (byte_count > 4) {
+                __m256i high = _mm256_slli_epi64(_mm256_cvtepu8_epi64(_mm_srli_si128(squares, 4)), TO_SQUARE_SHIFT);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + written + 4), _mm256_or_si256(base_vector, high));
+            }
+            written += byte_count;
+        }
+        moves.count += count;
+        return;
+    }
+#endif
+    for (int i = 0; targets; ++i) {
+        out[i] = std::bit_cast<Move>(packed_base | (uint64_t(get_lsb(targets)) << TO_SQUARE_SHIFT));
+        targets &= targets - 1;
+    }
+    moves.count += count;
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include "constants.h"
+#include "utils.h"
+
+// NNUE evaluation: 768 piece-square inputs seen from each side feed HIDDEN_SIZE clipped-ReLU
+// neurons per perspective; both halves (side to move first) feed a single output neuron.
+// The first layer lives in Board as an accumulator stack that make_move/undo_move keep current,
+// so a full evaluation is just the clipped dot product of the output layer.
+namespace nnue {
+    constexpr int INPUT_SIZE = 768;
+    constexpr int HIDDEN_SIZE = 256;
+    constexpr int ACTIVATION_CLIP = 127;   // accumulator values are clamped to [0, 127] before the output layer
+    constexpr int OUTPUT_WEIGHT_SCALE = 64; // output weights are int8, quantised by this factor
+    constexpr int EVAL_SCALE = 400;         // network output units to centipawns
+    constexpr const char* DEFAULT_EVAL_FILE = "nn.cbnn";
+
+    struct alignas(64) Accumulator {
+        int16_t values[2][HIDDEN_SIZE]; // [perspective][neuron]
+    };
+
+    struct FeatureChange {
+        Color color;
+        PieceType piece;
+        int square;
+    };
+
+    // Input index of a piece as seen from perspective: own pieces first, board flipped for black
+    inline int feature_index(Color perspective, Color piece_color, PieceType piece, int square) {
+        int relative_square = perspective == Color::WHITE ? square : square ^ 56;
+        int relative_color = piece_color == perspective ? 0 : 1;
+        return (relative_color * 6 + to_int(piece)) * 64 + relative_square;
+    }
+
+    // File layout (little endian): "CBNN", uint32 version, uint32 input size, uint32 hidden size,
+    // int16 feature weights [input][hidden], int16 feature biases [hidden],
+    // int8 output weights [2 * hidden], int32 output bias.
+    bool load(const std::string& path);
+    bool is_loaded();
+    // UCI "UseNNUE": evaluate() only uses the network when it is loaded and enabled
+    void set_enabled(bool enabled);
+    bool is_enabled();
+
+    void refresh(Accumulator& accumulator, const std::array<std::array<uint64_t, 6>, 2>& pieces);
+    // out = in with the removed features subtracted and the added ones added, for both perspectives
+    void update(Accumulator& out, const Accumulator& in,
+        const FeatureChange* added, int added_count, const FeatureChange* removed, int removed_count);
+    // Centipawns from the side to move's point of view
+    int evaluate(const Accumulator& accumulator, Color side_to_move);
+}
@@ -1,7 +1,7 @@
 #pragma once
 // === PST TABLES (for pst.h) ===
 
-const int MG_PST[6][64] = {
+constexpr int MG_PST[6][64] = {
     // White Pieces (Color::WHITE)
         // Pawns (PieceType::PAWN)
         {    0,   0,   0,   0,   0,   0,   0,   0,
@@ -59,7 +59,7 @@ const int MG_PST[6][64] = {
                         71,  87,  90, -56, -34,  34, 108, 209 }
 };
 
-const int EG_PST[6][64] = {
+constexpr int EG_PST[6][64] = {
     // White Pieces (Color::WHITE)
         // Pawns (PieceType::PAWN)
         {    0,   0,   0,   0,   0,   0,   0,   0,
@@ -1,6 +1,7 @@
 #pragma once
 #include "board.h"
-const int PIECE_VALUES[6] = { 100,320,330,500,900,10000 };
+// Indexed by PieceType; the NONE slot makes a quiet move (nothing captured) gain 0
+const int PIECE_VALUES[7] = { 100,320,330,500,900,10000,0 };
 static int see_capture(
     const Board& board,
     int from_sq,
@@ -0,0 +1,52 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#if defined(USE_PEXT)
+#include <immintrin.h>
+#endif
+
+// Per-square slider lookup. The attack pointers of all 128 entries point into one shared,
+// cache-line-aligned arena that slider_attacks.cpp builds during static initialization.
+#if defined(USE_PEXT)
+using SliderEntry = uint16_t;
+#else
+using SliderEntry = uint64_t;
+#endif
+
+struct SliderMagic {
+    uint64_t mask;
+#if defined(USE_PEXT)
+    // Entries hold the attack set compressed with PEXT over the empty-board attacks
+    // (at most 14 bits for a rook), so the table is a quarter of the 64-bit layout.
+    uint64_t attack_mask;
+    const SliderEntry* attacks;
+
+    unsigned index(uint64_t occupied) const {
+        return static_cast<unsigned>(_pext_u64(occupied, mask));
+    }
+    uint64_t lookup(uint64_t occupied) const {
+        return _pdep_u64(attacks[index(occupied)], attack_mask);
+    }
+#else
+    uint64_t magic;
+    const SliderEntry* attacks;
+    unsigned shift;
+
+    unsigned index(uint64_t occupied) const {
+        return static_cast<unsigned>(((occupied & mask) * magic) >> shift);
+    }
+    uint64_t lookup(uint64_t occupied) const {
+        return attacks[index(occupied)];
+    }
+#endif
+};
+
+extern SliderMagic BISHOP_MAGICS[64];
+extern SliderMagic ROOK_MAGICS[64];
+
+struct SliderTableStats {
+    size_t entries;
+    size_t bytes;
+    double build_ms;
+};
+const SliderTableStats& get_slider_table_stats();
@@ -3,12 +3,12 @@
 #include <cstdint>
 #include <iostream>
 #include <algorithm>
+#include <array>
 #include "constants.h"
 #include "pst.h"
 #include "Move.h"
 #include "notation_utils.h"
-#include "bishop_tables.h"
-#include "rook_tables.h"
+#include "slider_attacks.h"
 #include "adjustable_parameters.h"
 #include "attack_rays.h"
 #include "bitboard_masks.h"
@@ -62,7 +62,7 @@ inline void display_bitboard(uint64_t bitboard){
 static inline uint64_t bit64(int sq) { return 1ULL << sq; }
 
 
-static inline Color flip_color(Color color) {
+static constexpr Color flip_color(Color color) {
     return (color == Color::WHITE) ? Color::BLACK : Color::WHITE;
 }
 
@@ -74,10 +74,10 @@ inline int popcount(uint64_t bitboard){
 #endif // _MSC_VER
 }
 
-inline int to_int(Color color){
+constexpr int to_int(Color color){
     return static_cast<int>(color);
 }
-inline int to_int(PieceType piece_type){
+constexpr int to_int(PieceType piece_type){
     return static_cast<int8_t>(piece_type);
 }
 
@@ -93,22 +93,6 @@ inline char get_piece_char(const PieceType& piece,const Color& color){
 }
 
 
-inline int get_mg_pos_score(const Color& color, const PieceType& piece,const int& square){
-    if(color==Color::WHITE){
-        return MG_PST[to_int(piece)][square];
-    }
-    else {
-		return -MG_PST[to_int(piece)][flip_square(square)];
-    }
-}
-inline int get_eg_pos_score(const Color& color, const PieceType& piece,const int& square){
-    if (color == Color::WHITE) {
-        return EG_PST[to_int(piece)][square];
-    }
-    else {
-        return -EG_PST[to_int(piece)][flip_square(square)];
-    }
-}
 inline Move parse_move(const std::string& move_str, MoveList& move_list){
     for (const Move& move : move_list)
     {
@@ -125,16 +109,11 @@ inline uint64_t get_king_attacks(int square) {
     return KING_ATTACKS[square];
 }
 inline uint64_t get_bishop_attacks(int from_square, uint64_t occupied) {
-
-    uint64_t bishop_blockers = BISHOP_BLOCKER_MASK[from_square] & occupied;
-    uint64_t index = (bishop_blockers * MAGIC_BISHOP_NUMBER[from_square]) >> BISHOP_SHIFT_NUMBERS[from_square];
-    return BISHOP_ATTACK_TABLE[BISHOP_ATTACK_OFFSET[from_square] + index];
+    return BISHOP_MAGICS[from_square].lookup(occupied);
 }
 inline uint64_t get_rook_attacks(int from_square, uint64_t occupied) {
     if (from_square < 0 || from_square>63) return 0;
-    uint64_t rook_blockers = ROOK_BLOCKER_MASK[from_square] & occupied;
-    uint64_t index = (rook_blockers * MAGIC_ROOK_NUMBER[from_square]) >> ROOK_SHIFT_NUMBERS[from_square];
-    return ROOK_ATTACK_TABLE[ROOK_ATTACK_OFFSET[from_square] + index];
+    return ROOK_MAGICS[from_square].lookup(occupied);
 }
 inline uint64_t get_queen_attacks(int from_square, uint64_t occupied) {
     return get_bishop_attacks(from_square, occupied) | get_rook_attacks(from_square, occupied);
@@ -146,8 +125,9 @@ inline uint64_t get_piece_attacks(PieceType pt, int from_square, uint64_t occupi
     else if (pt == PieceType::QUEEN) return get_queen_attacks(from_square, occupied);
     else return 0;
 }
-inline uint64_t get_pawn_attacks(uint64_t pawns, Color color) {
-    if (Color::WHITE == color) {
+template <Color C>
+inline uint64_t get_pawn_attacks(uint64_t pawns) {
+    if constexpr (Color::WHITE == C) {
         return ((pawns & NOT_FILE_A) << 7) | ((pawns & NOT_FILE_H) << 9);
 	}
     else {
@@ -155,6 +135,9 @@ inline uint64_t get_pawn_attacks(uint64_t pawns, Color color) {
     
     }
 }
+inline uint64_t get_pawn_attacks(uint64_t pawns, Color color) {
+    return Color::WHITE == color ? get_pawn_attacks<Color::WHITE>(pawns) : get_pawn_attacks<Color::BLACK>(pawns);
+}
 inline uint64_t get_pawn_attackers(int to_square, Color attacker_color, uint64_t attacker_pawns) {
     uint64_t bb = get_pawn_attacks(bit64(to_square), flip_color(attacker_color));
     return bb & attacker_pawns;
@@ -243,34 +226,78 @@ inline int king_distance(int sq1, int sq2) {
     return std::max(std::abs(file1 - file2), std::abs(rank1 - rank2));
 }
 
+// Middlegame and endgame score packed into one 32-bit word, mg in the high half and eg in the low
+// half, so adding, subtracting or scaling a score updates both phases with one integer operation.
+// The arithmetic wraps modulo 2^32; as long as each phase ends up in int16 range the halves read
+// back exactly (a negative eg borrows one from the mg half, which mg_score() rounds back in).
 struct EvaluationResult {
-    int16_t mg_score;
-    int16_t eg_score;
-    EvaluationResult& operator+=(const EvaluationResult& other) {
-        this->mg_score += other.mg_score;
-        this->eg_score += other.eg_score;
+    uint32_t packed = 0;
+
+    constexpr EvaluationResult() = default;
+    constexpr EvaluationResult(int mg, int eg)
+        : packed((static_cast<uint32_t>(mg) << 16) + static_cast<uint32_t>(eg)) {}
+
+    constexpr int mg_score() const {
+        return static_cast<int16_t>(static_cast<uint16_t>((packed + 0x8000u) >> 16));
+    }
+    constexpr int eg_score() const {
+        return static_cast<int16_t>(static_cast<uint16_t>(packed));
+    }
+    constexpr EvaluationResult& operator+=(const EvaluationResult& other) {
+        packed += other.packed;
         return *this;
     }
-    EvaluationResult& operator-=(const EvaluationResult& other) {
-        this->mg_score -= other.mg_score;
-        this->eg_score -= other.eg_score;
+    constexpr EvaluationResult& operator-=(const EvaluationResult& other) {
+        packed -= other.packed;
         return *this;
 	}
+    constexpr bool operator==(const EvaluationResult& other) const = default;
 };
-inline EvaluationResult operator+(EvaluationResult lhs, const EvaluationResult& rhs) {
+constexpr EvaluationResult operator+(EvaluationResult lhs, const EvaluationResult& rhs) {
     lhs += rhs;
     return lhs;
 }
-inline EvaluationResult operator-(EvaluationResult lhs, const EvaluationResult& rhs) {
-    lhs.mg_score -= rhs.mg_score;
-    lhs.eg_score -= rhs.eg_score;
+constexpr EvaluationResult operator-(EvaluationResult lhs, const EvaluationResult& rhs) {
+    lhs -= rhs;
     return lhs;
 }
+constexpr EvaluationResult operator-(EvaluationResult score) {
+    score.packed = 0u - score.packed;
+    return score;
+}
+constexpr EvaluationResult operator*(int factor, EvaluationResult score) {
+    score.packed *= static_cast<uint32_t>(factor);
+    return score;
+}
+constexpr EvaluationResult operator*(EvaluationResult score, int factor) {
+    return factor * score;
+}
+
+// Packed piece values and PSTs, signed and mirrored per colour: [color][piece](/[square]).
+// MG_PST/EG_PST stay separate in pst.h as the tuner writes them and are merged here at compile time.
+inline constexpr auto PACKED_PIECE_VALUES = [] {
+    std::array<std::array<EvaluationResult, 6>, 2> table{};
+    for (int piece = 0; piece < 6; ++piece) {
+        table[0][piece] = EvaluationResult(PIECE_VALUES_MG[piece], PIECE_VALUES_EG[piece]);
+        table[1][piece] = -table[0][piece];
+    }
+    return table;
+}();
+inline constexpr auto PACKED_PST = [] {
+    std::array<std::array<std::array<EvaluationResult, 64>, 6>, 2> table{};
+    for (int piece = 0; piece < 6; ++piece) {
+        for (int square = 0; square < 64; ++square) {
+            table[0][piece][square] = EvaluationResult(MG_PST[piece][square], EG_PST[piece][square]);
+            table[1][piece][square] = -EvaluationResult(MG_PST[piece][flip_square(square)], EG_PST[piece][flip_square(square)]);
+        }
+    }
+    return table;
+}();
 inline EvaluationResult get_piece_values(const Color& color, const PieceType& piece) {
-    EvaluationResult result = { 0,0 };
-    result.mg_score = color == Color::WHITE ? PIECE_VALUES_MG[to_int(piece)] : -PIECE_VALUES_MG[to_int(piece)];
-    result.eg_score = color == Color::WHITE ? PIECE_VALUES_EG[to_int(piece)] : -PIECE_VALUES_EG[to_int(piece)];
-    return result;
+    return PACKED_PIECE_VALUES[to_int(color)][to_int(piece)];
+}
+inline EvaluationResult get_pos_score(const Color& color, const PieceType& piece, const int& square) {
+    return PACKED_PST[to_int(color)][to_int(piece)][square];
 }
 inline bool is_on_center_files(int king_square) {
     uint64_t center_file_mask = FILE_MASK[3] | FILE_MASK[4] | FILE_MASK[5];
@@ -1,16 +1,54 @@
 #pragma once
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include "constants.h"
 
-class Zobrist {
-    public:
-        static uint64_t piece_keys[2][6][64];
-        static uint64_t black_to_move_key;
-        static uint64_t castling_keys[16];
-        static uint64_t en_passant_keys[8];
+// Keys are generated at compile time by a counter-based splitmix64, so every key is a pure
+// function of its index: the tables live in read-only data and need no startup initialization.
+namespace zobrist_detail {
+    constexpr uint64_t SEED = 123456789;
+
+    // Index layout: 768 piece-square keys, then side to move, castling and en passant.
+    constexpr uint64_t SIDE_INDEX = 2 * 6 * 64;
+    constexpr uint64_t CASTLING_INDEX = SIDE_INDEX + 1;
+    constexpr uint64_t EN_PASSANT_INDEX = CASTLING_INDEX + 16;
+
+    constexpr uint64_t key(uint64_t index) {
+        uint64_t z = SEED + (index + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
 
-        static void initialize_keys();
+    using PieceKeys = std::array<std::array<std::array<uint64_t, 64>, 6>, 2>;
 
+    constexpr PieceKeys make_piece_keys() {
+        PieceKeys keys{};
+        for (int color = 0; color < 2; ++color) {
+            for (int piece = 0; piece < 6; ++piece) {
+                for (int square = 0; square < 64; ++square) {
+                    keys[color][piece][square] = key((color * 6 + piece) * 64 + square);
+                }
+            }
+        }
+        return keys;
+    }
 
-    
-};
\ No newline at end of file
+    template<std::size_t N>
+    constexpr std::array<uint64_t, N> make_keys(uint64_t first_index) {
+        std::array<uint64_t, N> keys{};
+        for (std::size_t i = 0; i < N; ++i) {
+            keys[i] = key(first_index + i);
+        }
+        return keys;
+    }
+}
+
+class Zobrist {
+    public:
+        static constexpr zobrist_detail::PieceKeys piece_keys = zobrist_detail::make_piece_keys();
+        static constexpr uint64_t black_to_move_key = zobrist_detail::key(zobrist_detail::SIDE_INDEX);
+        static constexpr std::array<uint64_t, 16> castling_keys = zobrist_detail::make_keys<16>(zobrist_detail::CASTLING_INDEX);
+        static constexpr std::array<uint64_t, 8> en_passant_keys = zobrist_detail::make_keys<8>(zobrist_detail::EN_PASSANT_INDEX);
+};
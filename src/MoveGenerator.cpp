@@ -6,57 +6,165 @@
 #include <array>
 #include "attack_rays.h"
 #include "constants.h"
-#include "rook_tables.h"
-#include "bishop_tables.h"
+#include "move_serializer.h"
 MoveGenerator::MoveGenerator()
 {
     
+}
+// Serialises one piece's targets in batches: the quiet ones, then one batch per captured piece
+// type, so the captured piece comes from the bitboards instead of a per-square lookup.
+template <Color Us>
+static inline void push_piece_moves(MoveList& moves, const Board& board, int from_square, PieceType piece, uint64_t targets) {
+    constexpr Color other_color = flip_color(Us);
+    serialize_targets(moves, Move(from_square, 0, piece, Us), targets & ~board.get_all_pieces());
+    uint64_t captures = targets & board.get_color_pieces(other_color);
+    for (int captured = to_int(PieceType::PAWN); captures && captured <= to_int(PieceType::QUEEN); ++captured) {
+        uint64_t victims = captures & board.get_pieces(other_color, PieceType(captured));
+        if (!victims) continue;
+        serialize_targets(moves, Move(from_square, 0, piece, Us, PieceType(captured)), victims);
+        captures &= ~victims;
+    }
 }
 template <bool captures_only, bool with_checks>
 void MoveGenerator::generate_moves(const Board& board,MoveList& move_list){
 	//if (board.is_fifty_move_rule_draw() || board.is_repetition_draw()) return move_list;
-    Color own_color=board.get_turn();
-    Color opponent_color=own_color==Color::WHITE ? Color::BLACK:Color::WHITE;
+    if (board.get_turn() == Color::WHITE) generate_moves_for<Color::WHITE, captures_only, with_checks>(board, move_list);
+    else generate_moves_for<Color::BLACK, captures_only, with_checks>(board, move_list);
+}
+// Everything below is specialised on the side to move, so pawn directions, promotion ranks
+// and castling squares fold into constants.
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_moves_for(const Board& board,MoveList& move_list){
+    constexpr Color own_color=Us;
+    constexpr Color opponent_color=flip_color(Us);
     int king_square=board.get_king_square(own_color);
-	uint64_t pinned_info = calculate_pinned_pieces(board, own_color,opponent_color,king_square);
     CheckInfo check_info=board.count_attacker_on_square(king_square,opponent_color);
     uint64_t own_pieces=board.get_color_pieces(own_color);
     if (check_info.count>1)
     { 
-        generate_king_moves<captures_only>(move_list, board, own_color, own_pieces, king_square);
-    }else if (check_info.count==1)
+        generate_king_moves<Us,captures_only>(move_list, board, own_pieces, king_square);
+        return;
+    }
+	uint64_t pinned_info = calculate_pinned_pieces<Us>(board, king_square);
+    if (check_info.count==1)
     {  
-        generate_king_moves<captures_only>(move_list,board, own_color,own_pieces ,king_square);
-        
-        PieceType checker=board.get_piece_on_square(check_info.attacker_square);
-        uint64_t remedy_mask=(1ULL<< check_info.attacker_square);
-        if (checker==PieceType::QUEEN || checker==PieceType::ROOK|| checker==PieceType::BISHOP) remedy_mask|=LINE_BETWEEN[king_square][check_info.attacker_square];
-        
-        generate_queen_moves<captures_only,with_checks>(move_list,board, own_color, pinned_info, remedy_mask);
-        
-        generate_rook_moves<captures_only,with_checks>(move_list,board, own_color, pinned_info, remedy_mask);
-
-        generate_bishop_moves<captures_only,with_checks>(move_list,board, own_color, pinned_info, remedy_mask);
-        generate_knight_moves<captures_only,with_checks>(move_list,board, own_color, pinned_info, remedy_mask);
-        
-        if (board.get_en_passant_rights() !=NO_SQUARE && checker == PieceType::PAWN) remedy_mask|=1ULL<<board.get_en_passant_rights();
-        generate_pawn_moves<captures_only, with_checks>(move_list,board, own_color,king_square, pinned_info, remedy_mask);
+        generate_king_moves<Us,captures_only>(move_list,board, own_pieces ,king_square);
+        // Every evasion is a check anyway, so with_checks only widens captures_only to all evasions
+        generate_evasions_for<Us, captures_only && !with_checks>(move_list, board, king_square, pinned_info, check_info.attacker_square);
     }
     else
     {
-        generate_queen_moves<captures_only,with_checks>(move_list, board, own_color, pinned_info, BOARD_ALL_SET);
+        generate_queen_moves<Us,captures_only,with_checks>(move_list, board, pinned_info, BOARD_ALL_SET);
 
-        generate_rook_moves<captures_only,with_checks>(move_list, board, own_color, pinned_info, BOARD_ALL_SET);
+        generate_rook_moves<Us,captures_only,with_checks>(move_list, board, pinned_info, BOARD_ALL_SET);
 
-        generate_bishop_moves<captures_only,with_checks>(move_list, board, own_color, pinned_info, BOARD_ALL_SET);
-        generate_knight_moves<captures_only,with_checks>(move_list, board, own_color, pinned_info, BOARD_ALL_SET);
+        generate_bishop_moves<Us,captures_only,with_checks>(move_list, board, pinned_info, BOARD_ALL_SET);
+        generate_knight_moves<Us,captures_only,with_checks>(move_list, board, pinned_info, BOARD_ALL_SET);
 
-        generate_pawn_moves<captures_only,with_checks>(move_list, board, own_color, king_square, pinned_info, BOARD_ALL_SET);
+        generate_pawn_moves<Us,captures_only,with_checks>(move_list, board, king_square, pinned_info, BOARD_ALL_SET);
 
-        generate_king_moves<captures_only>(move_list, board, own_color, own_pieces, king_square);
+        generate_king_moves<Us,captures_only>(move_list, board, own_pieces, king_square);
+
+        if constexpr (captures_only && with_checks) generate_discovered_checks<Us>(move_list, board, king_square, pinned_info);
     }
 }
-uint64_t MoveGenerator::calculate_pinned_pieces(const Board& board, const Color friendly_color,const Color opponent_color, int king_square) {
+// Single check: only captures of the checker and interpositions on the line to the king help.
+// Instead of running every piece generator under a mask, walk those few target squares and look
+// backwards for the unpinned pieces that reach them (a pinned piece can never answer a single check).
+template <Color Us, bool captures_only>
+void MoveGenerator::generate_evasions_for(MoveList& moves, const Board& board, int king_square, const uint64_t& pinned_info, int checker_square) {
+    constexpr Color own_color = Us;
+    constexpr Color other_color = flip_color(Us);
+    constexpr int push_step = (own_color == Color::WHITE) ? 8 : -8;
+    constexpr uint64_t double_push_target_rank = (own_color == Color::WHITE) ? 0x00000000FF000000ULL : 0x000000FF00000000ULL;
+    constexpr uint64_t promotion_rank_mask = (own_color == Color::WHITE) ? 0xFF00000000000000ULL : 0xFFULL;
+
+    PieceType checker = board.get_piece_on_square(checker_square);
+    uint64_t occupied = board.get_all_pieces();
+    uint64_t movable = board.get_color_pieces(own_color) & ~pinned_info;
+    uint64_t pawns = board.get_pieces(own_color, PieceType::PAWN) & movable;
+    uint64_t knights = board.get_pieces(own_color, PieceType::KNIGHT) & movable;
+    uint64_t bishops = board.get_pieces(own_color, PieceType::BISHOP) & movable;
+    uint64_t rooks = board.get_pieces(own_color, PieceType::ROOK) & movable;
+    uint64_t queens = board.get_pieces(own_color, PieceType::QUEEN) & movable;
+
+    uint64_t targets = bit64(checker_square);
+    if constexpr (!captures_only) {
+        if (checker == PieceType::QUEEN || checker == PieceType::ROOK || checker == PieceType::BISHOP) {
+            targets |= LINE_BETWEEN[king_square][checker_square] & ~(bit64(king_square) | bit64(checker_square));
+        }
+    }
+
+    auto push_from = [&](uint64_t from_set, int to_square, PieceType piece, PieceType captured) {
+        while (from_set) {
+            moves.push_back(Move(get_lsb(from_set), to_square, piece, own_color, captured));
+            from_set &= from_set - 1;
+        }
+    };
+    auto push_pawn = [&](int from_square, int to_square, PieceType captured) {
+        if (bit64(to_square) & promotion_rank_mask) {
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, captured, PieceType::QUEEN));
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, captured, PieceType::ROOK));
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, captured, PieceType::BISHOP));
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, captured, PieceType::KNIGHT));
+        }
+        else {
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, captured));
+        }
+    };
+
+    while (targets) {
+        int to_square = get_lsb(targets);
+        targets &= targets - 1;
+        PieceType captured = to_square == checker_square ? checker : PieceType::NONE;
+
+        push_from(KNIGHT_ATTACKS[to_square] & knights, to_square, PieceType::KNIGHT, captured);
+        uint64_t diagonal = get_bishop_attacks(to_square, occupied);
+        push_from(diagonal & bishops, to_square, PieceType::BISHOP, captured);
+        uint64_t orthogonal = get_rook_attacks(to_square, occupied);
+        push_from(orthogonal & rooks, to_square, PieceType::ROOK, captured);
+        push_from((diagonal | orthogonal) & queens, to_square, PieceType::QUEEN, captured);
+
+        if (captured != PieceType::NONE) {
+            uint64_t capturers = PAWN_ATTACKS[to_int(other_color)][to_square] & pawns;
+            while (capturers) {
+                push_pawn(get_lsb(capturers), to_square, captured);
+                capturers &= capturers - 1;
+            }
+            continue;
+        }
+        // Shift the bitboard backwards rather than the square index: targets on the back ranks have no square behind them
+        uint64_t one_back = (own_color == Color::WHITE) ? bit64(to_square) >> 8 : bit64(to_square) << 8;
+        uint64_t two_back = (own_color == Color::WHITE) ? one_back >> 8 : one_back << 8;
+        if (one_back & pawns) {
+            push_pawn(to_square - push_step, to_square, PieceType::NONE);
+        }
+        else if ((bit64(to_square) & double_push_target_rank) && !(one_back & occupied) && (two_back & pawns)) {
+            moves.push_back(Move(to_square - 2 * push_step, to_square, PieceType::PAWN, own_color, PieceType::NONE));
+        }
+    }
+
+    // A pawn that just double-pushed into check can also be taken en passant; the capture empties
+    // two squares, so check the resulting occupancy against the enemy sliders directly
+    int ep_square = board.get_en_passant_rights();
+    if (ep_square != NO_SQUARE && ep_square - push_step == checker_square) {
+        uint64_t rooks_queens = board.get_pieces(other_color, PieceType::ROOK) | board.get_pieces(other_color, PieceType::QUEEN);
+        uint64_t bishops_queens = board.get_pieces(other_color, PieceType::BISHOP) | board.get_pieces(other_color, PieceType::QUEEN);
+        uint64_t capturers = PAWN_ATTACKS[to_int(other_color)][ep_square] & pawns;
+        while (capturers) {
+            int from_square = get_lsb(capturers);
+            uint64_t after = occupied ^ bit64(from_square) ^ bit64(checker_square) ^ bit64(ep_square);
+            if (!(get_rook_attacks(king_square, after) & rooks_queens) && !(get_bishop_attacks(king_square, after) & bishops_queens)) {
+                moves.push_back(Move(from_square, ep_square, PieceType::PAWN, own_color, PieceType::PAWN, PieceType::NONE, false, true));
+            }
+            capturers &= capturers - 1;
+        }
+    }
+}
+template <Color Us>
+uint64_t MoveGenerator::calculate_pinned_pieces(const Board& board, int king_square) {
+    constexpr Color friendly_color = Us;
+    constexpr Color opponent_color = flip_color(Us);
 	uint64_t all_rook_bockers = get_rook_attacks(king_square, board.get_all_pieces());
 	uint64_t all_bishop_blockers = get_bishop_attacks(king_square, board.get_all_pieces());
     uint64_t possible_rook_pinned = all_rook_bockers & board.get_color_pieces(friendly_color) & ~FOUR_CORNER_MASK;
@@ -88,35 +196,57 @@ uint64_t MoveGenerator::calculate_pinned_pieces(const Board& board, const Color
       
 }
 
-template <bool captures_only>
-void MoveGenerator::generate_king_moves(MoveList& moves,const Board& board,const Color own_color, const uint64_t& own_pieces, int king_square){
+// Every square the attacker side hits, with the defending king lifted off the board so that
+// squares behind it on a checking slider's line count as attacked.
+template <Color Them>
+uint64_t MoveGenerator::calculate_enemy_attacks(const Board& board, int king_square) {
+    constexpr Color attacker_color = Them;
+    uint64_t occupancy = board.get_all_pieces() ^ bit64(king_square);
+    uint64_t attacks = get_pawn_attacks<Them>(board.get_pieces(attacker_color, PieceType::PAWN))
+        | KING_ATTACKS[board.get_king_square(attacker_color)];
+
+    uint64_t knights = board.get_pieces(attacker_color, PieceType::KNIGHT);
+    while (knights) {
+        attacks |= KNIGHT_ATTACKS[get_lsb(knights)];
+        knights &= knights - 1;
+    }
+    uint64_t queens = board.get_pieces(attacker_color, PieceType::QUEEN);
+    uint64_t diagonal = board.get_pieces(attacker_color, PieceType::BISHOP) | queens;
+    while (diagonal) {
+        attacks |= get_bishop_attacks(get_lsb(diagonal), occupancy);
+        diagonal &= diagonal - 1;
+    }
+    uint64_t orthogonal = board.get_pieces(attacker_color, PieceType::ROOK) | queens;
+    while (orthogonal) {
+        attacks |= get_rook_attacks(get_lsb(orthogonal), occupancy);
+        orthogonal &= orthogonal - 1;
+    }
+    return attacks;
+}
+
+template <Color Us, bool captures_only>
+void MoveGenerator::generate_king_moves(MoveList& moves,const Board& board, const uint64_t& own_pieces, int king_square){
+        constexpr Color own_color=Us;
+        constexpr Color other_color=flip_color(Us);
         uint64_t possible_moves=KING_ATTACKS[king_square]&~own_pieces;
-        Color other_color=own_color==Color::WHITE ? Color::BLACK:Color::WHITE;
-        if (captures_only) possible_moves&=board.get_color_pieces(other_color);
-        while (possible_moves)
-        {
-            int to_square=get_lsb(possible_moves);
-            if (board.count_attacker_on_square(to_square,other_color,1,false).count>0)
-            {
-                possible_moves&=possible_moves-1;
-                continue;
-            }
-            moves.push_back(Move(king_square,to_square,PieceType::KING,own_color,
-                board.get_piece_on_square(to_square)));
-            possible_moves&=possible_moves-1;
-        }
-        if (board.count_attacker_on_square(king_square,other_color,1,false).count>0) return;
-		uint8_t king_castle_mask = own_color == Color::WHITE ? WHITE_KING_CASTLE : BLACK_KING_CASTLE;
-		uint8_t queen_castle_mask = own_color == Color::WHITE ? WHITE_QUEEN_CASTLE : BLACK_QUEEN_CASTLE;
-        if ((board.get_castle_rights() & king_castle_mask)!= 0)
+        if constexpr (captures_only) possible_moves&=board.get_color_pieces(other_color);
+		constexpr uint8_t king_castle_mask = own_color == Color::WHITE ? WHITE_KING_CASTLE : BLACK_KING_CASTLE;
+		constexpr uint8_t queen_castle_mask = own_color == Color::WHITE ? WHITE_QUEEN_CASTLE : BLACK_QUEEN_CASTLE;
+        uint8_t castle_rights = board.get_castle_rights() & (king_castle_mask | queen_castle_mask);
+        if (!possible_moves && !castle_rights) return;
+
+        uint64_t enemy_attacks = calculate_enemy_attacks<other_color>(board, king_square);
+        possible_moves &= ~enemy_attacks;
+        push_piece_moves<Us>(moves, board, king_square, PieceType::KING, possible_moves);
+        if (enemy_attacks & bit64(king_square)) return;
+        if ((castle_rights & king_castle_mask)!= 0)
         {   
-            int rook_square=king_square+3;
             uint64_t line_between=LINE_BETWEEN[king_square+1][king_square+2];
     
             if ((line_between & board.get_all_pieces())==0)
             {   
                 
-                if (board.count_attacker_on_square(king_square+1,other_color,1,false).count==0 && board.count_attacker_on_square(king_square+2,other_color,1,false).count==0)
+                if ((line_between & enemy_attacks)==0)
                 {
                     moves.push_back(Move(king_square,king_square+2,PieceType::KING,own_color,
                         PieceType::NONE,PieceType::NONE,true));
@@ -125,12 +255,12 @@ void MoveGenerator::generate_king_moves(MoveList& moves,const Board& board,const
             }
             
         }
-		if ((board.get_castle_rights() & queen_castle_mask) != 0)
+		if ((castle_rights & queen_castle_mask) != 0)
         {
             uint64_t line_between=LINE_BETWEEN[king_square-1][king_square-3];
             if ((line_between & board.get_all_pieces())==0)
             {
-                if (board.count_attacker_on_square(king_square-1,other_color,1,false).count==0 && board.count_attacker_on_square(king_square-2,other_color,1,false).count==0)
+                if ((LINE_BETWEEN[king_square-1][king_square-2] & enemy_attacks)==0)
                 {
                     moves.push_back(Move(king_square,king_square-2,PieceType::KING,own_color,
                         PieceType::NONE,PieceType::NONE,true));
@@ -142,128 +272,91 @@ void MoveGenerator::generate_king_moves(MoveList& moves,const Board& board,const
     return;
 }
 
-template <bool captures_only, bool with_checks>
-void MoveGenerator::generate_queen_moves(MoveList& moves,const Board& board, Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask) {
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_queen_moves(MoveList& moves,const Board& board, const uint64_t& pinned_info, uint64_t remedy_mask) {
+    constexpr Color own_color = Us;
     //return generate_sliding_moves(moves,PieceType::QUEEN,board,own_color,pinned_info,remedy_mask,captures_only);
     uint64_t queens = board.get_pieces(own_color, PieceType::QUEEN);
     uint64_t occupied = board.get_all_pieces();
     uint64_t own_pieces = board.get_color_pieces(own_color); 
     if constexpr (captures_only) {
-        Color other_color = own_color == Color::WHITE ? Color::BLACK : Color::WHITE;
+        constexpr Color other_color = flip_color(Us);
         uint64_t mask_changer = board.get_color_pieces(other_color);
-        if constexpr (with_checks) {
-            int op_king_square = board.get_king_square(other_color);
-            mask_changer |= get_queen_attacks(op_king_square,occupied);
-        }
+        if constexpr (with_checks) mask_changer |= board.get_check_squares().squares[to_int(PieceType::QUEEN)];
         remedy_mask &= mask_changer;
     }
     while (queens) {
         int from_square = get_lsb(queens);
-        uint64_t bishop_attacks = 0;
-        uint64_t bishop_blockers = BISHOP_BLOCKER_MASK[from_square] & occupied;
-        uint64_t index = (bishop_blockers * MAGIC_BISHOP_NUMBER[from_square]) >> BISHOP_SHIFT_NUMBERS[from_square];
-        bishop_attacks = BISHOP_ATTACK_TABLE[BISHOP_ATTACK_OFFSET[from_square] + index];
-        uint64_t rook_attacks = 0;
-        uint64_t rook_blockers = ROOK_BLOCKER_MASK[from_square] & occupied;
-        index = (rook_blockers * MAGIC_ROOK_NUMBER[from_square]) >> ROOK_SHIFT_NUMBERS[from_square];
-        rook_attacks = ROOK_ATTACK_TABLE[ROOK_ATTACK_OFFSET[from_square] + index];
-        uint64_t attacks = bishop_attacks | rook_attacks;
+        uint64_t attacks = get_queen_attacks(from_square, occupied);
         attacks&= ~own_pieces & remedy_mask;
         if (bit64(from_square) & pinned_info) {
 			attacks &= COMPLETE_LINE[from_square][board.get_king_square(own_color)];
         }
-        while (attacks) {
-            int to_square = get_lsb(attacks);
-            moves.push_back(Move(from_square, to_square, PieceType::QUEEN, own_color, board.get_piece_on_square(to_square)));
-            attacks &= attacks - 1;
-
-        }
+        push_piece_moves<Us>(moves, board, from_square, PieceType::QUEEN, attacks);
         queens &= queens - 1;
 
     }
 }
 
-template <bool captures_only, bool with_checks>
-void MoveGenerator::generate_rook_moves(MoveList& moves,const Board& board, Color own_color, const uint64_t& pinned_info,uint64_t remedy_mask) {
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_rook_moves(MoveList& moves,const Board& board, const uint64_t& pinned_info, uint64_t remedy_mask) {
+    constexpr Color own_color = Us;
     //return generate_sliding_moves(moves,PieceType::ROOK,board,own_color,pinned_info,remedy_mask,captures_only);
     uint64_t rooks = board.get_pieces(own_color, PieceType::ROOK);
     uint64_t occupied = board.get_all_pieces();
     uint64_t own_pieces = board.get_color_pieces(own_color); 
     if constexpr (captures_only) {
-        Color other_color = own_color == Color::WHITE ? Color::BLACK : Color::WHITE;
+        constexpr Color other_color = flip_color(Us);
         uint64_t mask_changer = board.get_color_pieces(other_color);
-        if constexpr (with_checks) {
-            int op_king_square = board.get_king_square(other_color);
-            mask_changer |= get_rook_attacks(op_king_square,occupied);
-        }
+        if constexpr (with_checks) mask_changer |= board.get_check_squares().squares[to_int(PieceType::ROOK)];
         remedy_mask &= mask_changer;
     }
     while (rooks) {
         int from_square = get_lsb(rooks);
-        uint64_t attacks=0;
-        uint64_t blockers = ROOK_BLOCKER_MASK[from_square] & occupied;
-        uint64_t index = (blockers * MAGIC_ROOK_NUMBER[from_square]) >> ROOK_SHIFT_NUMBERS[from_square];
-        attacks = ROOK_ATTACK_TABLE[ROOK_ATTACK_OFFSET[from_square] + index] & ~own_pieces & remedy_mask;
+        uint64_t attacks = get_rook_attacks(from_square, occupied) & ~own_pieces & remedy_mask;
         if (bit64(from_square) & pinned_info) {
             attacks &= COMPLETE_LINE[from_square][board.get_king_square(own_color)];
         }
-        while (attacks) {
-            int to_square = get_lsb(attacks);
-            moves.push_back(Move(from_square, to_square, PieceType::ROOK, own_color, board.get_piece_on_square(to_square)));
-            attacks &= attacks - 1;
-
-        }
+        push_piece_moves<Us>(moves, board, from_square, PieceType::ROOK, attacks);
         rooks &= rooks - 1;
 
     }
 
 }
-template <bool captures_only, bool with_checks>
-void MoveGenerator::generate_bishop_moves(MoveList& moves,const Board& board, Color own_color, const uint64_t& pinned_info, uint64_t remedy_mask) {
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_bishop_moves(MoveList& moves,const Board& board, const uint64_t& pinned_info, uint64_t remedy_mask) {
+    constexpr Color own_color = Us;
     //return generate_sliding_moves(moves,PieceType::BISHOP,board,own_color,pinned_info,remedy_mask,captures_only);
     uint64_t bishops = board.get_pieces(own_color, PieceType::BISHOP);
     uint64_t occupied = board.get_all_pieces();
     uint64_t own_pieces = board.get_color_pieces(own_color); 
     if constexpr (captures_only) {
-        Color other_color = own_color == Color::WHITE ? Color::BLACK : Color::WHITE;
+        constexpr Color other_color = flip_color(Us);
         uint64_t mask_changer = board.get_color_pieces(other_color);
-        if constexpr (with_checks) {
-            int op_king_square = board.get_king_square(other_color);
-            mask_changer |= get_bishop_attacks(op_king_square,occupied);
-        }
+        if constexpr (with_checks) mask_changer |= board.get_check_squares().squares[to_int(PieceType::BISHOP)];
         remedy_mask &= mask_changer;
     }
     while (bishops) {
         int from_square = get_lsb(bishops);
-        uint64_t attacks = 0;
-        uint64_t blockers = BISHOP_BLOCKER_MASK[from_square] & occupied;
-        uint64_t index = (blockers * MAGIC_BISHOP_NUMBER[from_square]) >> BISHOP_SHIFT_NUMBERS[from_square];
-        attacks = BISHOP_ATTACK_TABLE[BISHOP_ATTACK_OFFSET[from_square] + index] & ~own_pieces & remedy_mask;
+        uint64_t attacks = get_bishop_attacks(from_square, occupied) & ~own_pieces & remedy_mask;
         if(bit64(from_square) & pinned_info) {
             attacks &= COMPLETE_LINE[from_square][board.get_king_square(own_color)];
 		}
-        while (attacks) {
-            int to_square = get_lsb(attacks);
-            moves.push_back(Move(from_square, to_square, PieceType::BISHOP, own_color, board.get_piece_on_square(to_square)));
-            attacks &= attacks - 1;
-
-        }
+        push_piece_moves<Us>(moves, board, from_square, PieceType::BISHOP, attacks);
         bishops &= bishops - 1;
 
     }
 
 }
-template <bool captures_only, bool with_checks>
-void MoveGenerator::generate_knight_moves(MoveList& moves,const Board& board, Color own_color, const uint64_t& pinned_info, uint64_t remedy_mask) {
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_knight_moves(MoveList& moves,const Board& board, const uint64_t& pinned_info, uint64_t remedy_mask) {
+    constexpr Color own_color = Us;
     uint64_t knight_bitboard=board.get_pieces(own_color,PieceType::KNIGHT);
     uint64_t own_pieces = board.get_color_pieces(own_color);
     if constexpr (captures_only) {
-         Color other_color = own_color == Color::WHITE ? Color::BLACK : Color::WHITE;
+        constexpr Color other_color = flip_color(Us);
         uint64_t mask_changer= board.get_color_pieces(other_color);
-        if constexpr (with_checks) {
-                        int op_king_square = board.get_king_square(other_color);
-						mask_changer |= get_knight_attacks(op_king_square);
-        }
+        if constexpr (with_checks) mask_changer |= board.get_check_squares().squares[to_int(PieceType::KNIGHT)];
 		remedy_mask &= mask_changer;
     }
     while (knight_bitboard)
@@ -275,35 +368,30 @@ void MoveGenerator::generate_knight_moves(MoveList& moves,const Board& board, Co
             continue;
         }
         uint64_t possible_moves=KNIGHT_ATTACKS[from_square]&~own_pieces&remedy_mask;
-        while (possible_moves)
-        {
-            int to_square=get_lsb(possible_moves);
-            moves.push_back(Move(from_square,to_square,PieceType::KNIGHT,own_color,board.get_piece_on_square(to_square)));
-            possible_moves&=possible_moves-1;
-        }
+        push_piece_moves<Us>(moves, board, from_square, PieceType::KNIGHT, possible_moves);
         knight_bitboard&=knight_bitboard-1; 
     }
     return;
 }
-template <bool captures_only,bool with_checks>
-void MoveGenerator::generate_pawn_moves(MoveList& moves,const Board& board, Color own_color,const int king_square, const uint64_t& pinned_info, const uint64_t& remedy_mask) {
+template <Color Us, bool captures_only,bool with_checks>
+void MoveGenerator::generate_pawn_moves(MoveList& moves,const Board& board, const int king_square, const uint64_t& pinned_info, const uint64_t& remedy_mask) {
     
     if constexpr (!captures_only || (captures_only&&with_checks))
     {
-        generate_pawn_pushes<with_checks>(moves,board,own_color,pinned_info,remedy_mask);
+        generate_pawn_pushes<Us,with_checks>(moves,board,pinned_info,remedy_mask);
     }
     
-    generate_pawn_captures<captures_only,with_checks>(moves,board,own_color,king_square,pinned_info,remedy_mask);
+    generate_pawn_captures<Us,captures_only,with_checks>(moves,board,king_square,pinned_info,remedy_mask);
     return;
 }
-template <bool captures_only,bool with_checks>
+template <Color Us, bool captures_only,bool with_checks>
 void MoveGenerator::generate_sliding_moves(
     MoveList& moves,
     PieceType piece,
     const Board& board,
-    Color own_color,
     const uint64_t& pinned_info, 
     const uint64_t& remedy_mask){
+    constexpr Color own_color = Us;
 
     uint64_t piece_bitboard=board.get_pieces(own_color,piece);    
     while (piece_bitboard)
@@ -333,8 +421,7 @@ void MoveGenerator::generate_sliding_moves(
             possible_moves &= COMPLETE_LINE[from_square][board.get_king_square(own_color)];
         }
         if constexpr (captures_only){
-            Color other_color=own_color==Color::WHITE ? Color::BLACK:Color::WHITE;
-            possible_moves &= board.get_color_pieces(other_color);
+            possible_moves &= board.get_color_pieces(flip_color(Us));
         }
         while (possible_moves)
         {
@@ -346,21 +433,18 @@ void MoveGenerator::generate_sliding_moves(
     }
     return;
 }
-template <bool with_checks>
-void MoveGenerator::generate_pawn_pushes(MoveList& moves,const Board& board,Color own_color,const uint64_t& pinned_info,uint64_t remedy_mask){
+template <Color Us, bool with_checks>
+void MoveGenerator::generate_pawn_pushes(MoveList& moves,const Board& board,const uint64_t& pinned_info,uint64_t remedy_mask){
+        constexpr Color own_color=Us;
 
         uint64_t own_pawns=board.get_pieces(own_color,PieceType::PAWN);
         uint64_t all_pieces=board.get_all_pieces();
-        int push_step=(own_color==Color::WHITE) ? 8:-8;
-        int start_rank=(own_color==Color::WHITE) ? 1:6;
-        int promotion_rank=(own_color==Color::WHITE) ? 6:1;
-		uint8_t castle_rights = board.get_castle_rights();
-		int en_passant_square = board.get_en_passant_rights();
-        if constexpr (with_checks) {
-			Color other_color = own_color == Color::WHITE ? Color::BLACK : Color::WHITE;
-            int op_king_square = board.get_king_square(other_color);
-            remedy_mask &= PAWN_ATTACKS[to_int(other_color)][op_king_square];
-        }
+        constexpr int push_step=(own_color==Color::WHITE) ? 8:-8;
+        constexpr int start_rank=(own_color==Color::WHITE) ? 1:6;
+        constexpr int promotion_rank=(own_color==Color::WHITE) ? 6:1;
+        // A pawn never checks from the last rank, so promotions keep the full mask and are tested piece by piece below
+        uint64_t push_mask = remedy_mask;
+        if constexpr (with_checks) push_mask &= board.get_check_squares().squares[to_int(PieceType::PAWN)];
         while (own_pawns)
         {
             int from_square = get_lsb(own_pawns);
@@ -374,16 +458,20 @@ void MoveGenerator::generate_pawn_pushes(MoveList& moves,const Board& board,Colo
                     if(bit64(from_square)& pinned_info) {
                         pinned_mask = COMPLETE_LINE[from_square][board.get_king_square(own_color)];
 					}
-                    if (pinned_mask & (1ULL<< to_square) & remedy_mask)
+                    bool is_promotion=(rank==promotion_rank);
+                    if (pinned_mask & (1ULL<< to_square) & (is_promotion ? remedy_mask : push_mask))
                     {
-                        bool is_promotion=(rank==promotion_rank);
                         if (is_promotion)
                         {
-                            
+                            if constexpr (with_checks) {
+                                generate_checking_promotions<Us>(moves, board, from_square, to_square);
+                            }
+                            else {
                         moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE,PieceType::QUEEN));
                         moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE,PieceType::ROOK));
                         moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE,PieceType::BISHOP));
                         moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE,PieceType::KNIGHT));
+                            }
                         }else
                         {
                             moves.push_back(Move(from_square,to_square,PieceType::PAWN,own_color,PieceType::NONE));
@@ -395,7 +483,7 @@ void MoveGenerator::generate_pawn_pushes(MoveList& moves,const Board& board,Colo
                         int to_square2=from_square+2*push_step;
                         if (!((1ULL<< to_square2)& all_pieces))
                         {
-                            if (pinned_mask & (1ULL<<to_square2) & remedy_mask)
+                            if (pinned_mask & (1ULL<<to_square2) & push_mask)
                             {
                                 moves.push_back(Move(from_square,to_square2,PieceType::PAWN,own_color,PieceType::NONE));
                             }
@@ -412,11 +500,27 @@ void MoveGenerator::generate_pawn_pushes(MoveList& moves,const Board& board,Colo
         }
         return;
 }
-template <bool captures_only, bool with_checks>
-void MoveGenerator::generate_pawn_captures(MoveList& moves,const Board& board, Color own_color,const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask){
-
+// Quiet promotions that give check with the promoted piece itself, tested with the pawn already
+// moved so a file it vacates counts as open. A discovered-check blocker leaving the line to the king
+// checks whatever it becomes; generate_discovered_checks adds all four of those.
+template <Color Us>
+void MoveGenerator::generate_checking_promotions(MoveList& moves, const Board& board, int from_square, int to_square) {
+    const CheckSquares& check_squares = board.get_check_squares();
+    if ((bit64(from_square) & check_squares.discovered_blockers)
+        && !(bit64(to_square) & COMPLETE_LINE[from_square][check_squares.king_square])) return;
+    uint64_t occupied = board.get_all_pieces() ^ bit64(from_square) ^ bit64(to_square);
+    for (PieceType promotion : { PieceType::QUEEN, PieceType::ROOK, PieceType::BISHOP, PieceType::KNIGHT }) {
+        if (get_piece_attacks(promotion, to_square, occupied) & bit64(check_squares.king_square)) {
+            moves.push_back(Move(from_square, to_square, PieceType::PAWN, Us, PieceType::NONE, promotion));
+        }
+    }
+}
+template <Color Us, bool captures_only, bool with_checks>
+void MoveGenerator::generate_pawn_captures(MoveList& moves,const Board& board, const int king_square,const uint64_t& pinned_info,const uint64_t& remedy_mask){
+        constexpr Color own_color=Us;
+        constexpr Color opponent_color=flip_color(Us);
+        constexpr uint64_t promotion_rank_mask=(own_color==Color::WHITE) ? 0xFF00000000000000ULL:0xFFULL;
         uint64_t own_pawns=board.get_pieces(own_color,PieceType::PAWN);
-        Color opponent_color =(own_color==Color::WHITE) ? Color::BLACK:Color::WHITE;
         uint64_t enemy_pieces=board.get_color_pieces(opponent_color);
         uint64_t new_remedy=remedy_mask;
         if (board.get_en_passant_rights()!=NO_SQUARE) new_remedy |=(1ULL<<board.get_en_passant_rights());
@@ -438,7 +542,7 @@ void MoveGenerator::generate_pawn_captures(MoveList& moves,const Board& board, C
                 int to_square=get_lsb(capture_bb);
                 PieceType captured_piece=board.get_piece_on_square(to_square);
 
-                bool is_promotion =(own_color==Color::WHITE && to_square>=56) || (own_color==Color::BLACK && to_square<=7);
+                bool is_promotion =(bit64(to_square) & promotion_rank_mask) != 0;
 
                 if (is_promotion
                 )
@@ -497,12 +601,193 @@ void MoveGenerator::generate_pawn_captures(MoveList& moves,const Board& board, C
         
 }
 
+// Quiet moves by a piece that shields one of our sliders from the enemy king. Direct checks
+// and captures were already emitted by the piece generators, so only empty squares that
+// leave the line to the king and are not in the piece's own check squares are added here.
+template <Color Us>
+void MoveGenerator::generate_discovered_checks(MoveList& moves, const Board& board, int king_square, const uint64_t& pinned_info) {
+    constexpr Color own_color = Us;
+    constexpr Color other_color = flip_color(Us);
+    constexpr int push_step = (own_color == Color::WHITE) ? 8 : -8;
+    constexpr int start_rank = (own_color == Color::WHITE) ? 1 : 6;
+    constexpr int promotion_rank = (own_color == Color::WHITE) ? 6 : 1;
+    const CheckSquares& check_squares = board.get_check_squares();
+    uint64_t blockers = check_squares.discovered_blockers;
+    if (!blockers) return;
+
+    uint64_t occupied = board.get_all_pieces();
+    uint64_t empty = ~occupied;
+    while (blockers) {
+        int from_square = get_lsb(blockers);
+        blockers &= blockers - 1;
+        PieceType piece = board.get_piece_on_square(from_square);
+        uint64_t targets = empty & ~COMPLETE_LINE[from_square][check_squares.king_square]
+                         & ~check_squares.squares[to_int(piece)];
+        if (bit64(from_square) & pinned_info) {
+            if (piece == PieceType::KNIGHT) continue;
+            targets &= COMPLETE_LINE[from_square][king_square];
+        }
+
+        if (piece == PieceType::PAWN) {
+            int to_square = from_square + push_step;
+            // Only a blocked pawn is done; a single push that gives direct check is generated elsewhere,
+            // but the double push behind it can still be a discovered check of its own
+            if (bit64(to_square) & occupied) continue;
+            if (bit64(to_square) & targets) {
+                if (from_square / 8 == promotion_rank) {
+                    moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE, PieceType::QUEEN));
+                    moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE, PieceType::ROOK));
+                    moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE, PieceType::BISHOP));
+                    moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE, PieceType::KNIGHT));
+                    continue;
+                }
+                moves.push_back(Move(from_square, to_square, PieceType::PAWN, own_color, PieceType::NONE));
+            }
+            int to_square2 = to_square + push_step;
+            if (from_square / 8 == start_rank && (bit64(to_square2) & targets)) {
+                moves.push_back(Move(from_square, to_square2, PieceType::PAWN, own_color, PieceType::NONE));
+            }
+            continue;
+        }
+
+        uint64_t attacks;
+        if (piece == PieceType::KING) {
+            attacks = KING_ATTACKS[from_square] & ~calculate_enemy_attacks<other_color>(board, king_square);
+        }
+        else {
+            attacks = get_piece_attacks(piece, from_square, occupied);
+        }
+        attacks &= targets;
+        while (attacks) {
+            int to_square = get_lsb(attacks);
+            moves.push_back(Move(from_square, to_square, piece, own_color, PieceType::NONE));
+            attacks &= attacks - 1;
+        }
+    }
+}
+
+int MoveGenerator::count_legal_moves(const Board& board) {
+    if (board.get_turn() == Color::WHITE) return count_legal_moves_for<Color::WHITE>(board);
+    return count_legal_moves_for<Color::BLACK>(board);
+}
+// Same pin and check masks as generate_moves_for, but target sets are popcounted instead of
+// being serialised, so no Move is built and no captured piece is looked up.
+template <Color Us>
+int MoveGenerator::count_legal_moves_for(const Board& board) {
+    constexpr Color own_color = Us;
+    constexpr Color other_color = flip_color(Us);
+    constexpr int push_step = (own_color == Color::WHITE) ? 8 : -8;
+    constexpr uint64_t double_push_rank = (own_color == Color::WHITE) ? 0x0000000000FF0000ULL : 0x0000FF0000000000ULL;
+    constexpr uint64_t promotion_rank_mask = (own_color == Color::WHITE) ? 0xFF00000000000000ULL : 0xFFULL;
+    constexpr uint8_t king_castle_mask = own_color == Color::WHITE ? WHITE_KING_CASTLE : BLACK_KING_CASTLE;
+    constexpr uint8_t queen_castle_mask = own_color == Color::WHITE ? WHITE_QUEEN_CASTLE : BLACK_QUEEN_CASTLE;
+
+    int king_square = board.get_king_square(own_color);
+    uint64_t own_pieces = board.get_color_pieces(own_color);
+    uint64_t enemy_pieces = board.get_color_pieces(other_color);
+    uint64_t occupied = board.get_all_pieces();
+
+    uint64_t enemy_attacks = calculate_enemy_attacks<other_color>(board, king_square);
+    int count = popcount(KING_ATTACKS[king_square] & ~own_pieces & ~enemy_attacks);
+
+    CheckInfo check_info = board.count_attacker_on_square(king_square, other_color);
+    if (check_info.count > 1) return count;
+
+    uint64_t remedy_mask = BOARD_ALL_SET;
+    if (check_info.count == 1) {
+        remedy_mask = bit64(check_info.attacker_square);
+        PieceType checker = board.get_piece_on_square(check_info.attacker_square);
+        if (checker == PieceType::QUEEN || checker == PieceType::ROOK || checker == PieceType::BISHOP) remedy_mask |= LINE_BETWEEN[king_square][check_info.attacker_square];
+    }
+    else {
+        uint8_t castle_rights = board.get_castle_rights();
+        if ((castle_rights & king_castle_mask) && !(LINE_BETWEEN[king_square + 1][king_square + 2] & (occupied | enemy_attacks))) count++;
+        if ((castle_rights & queen_castle_mask) && !(LINE_BETWEEN[king_square - 1][king_square - 3] & occupied)
+            && !(LINE_BETWEEN[king_square - 1][king_square - 2] & enemy_attacks)) count++;
+    }
+
+    uint64_t pinned_info = calculate_pinned_pieces<Us>(board, king_square);
+    uint64_t targets = ~own_pieces & remedy_mask;
+
+    uint64_t knights = board.get_pieces(own_color, PieceType::KNIGHT) & ~pinned_info;
+    while (knights) {
+        count += popcount(KNIGHT_ATTACKS[get_lsb(knights)] & targets);
+        knights &= knights - 1;
+    }
+    uint64_t diagonal = board.get_pieces(own_color, PieceType::BISHOP) | board.get_pieces(own_color, PieceType::QUEEN);
+    while (diagonal) {
+        int from_square = get_lsb(diagonal);
+        uint64_t attacks = get_bishop_attacks(from_square, occupied) & targets;
+        if (bit64(from_square) & pinned_info) attacks &= COMPLETE_LINE[from_square][king_square];
+        count += popcount(attacks);
+        diagonal &= diagonal - 1;
+    }
+    uint64_t orthogonal = board.get_pieces(own_color, PieceType::ROOK) | board.get_pieces(own_color, PieceType::QUEEN);
+    while (orthogonal) {
+        int from_square = get_lsb(orthogonal);
+        uint64_t attacks = get_rook_attacks(from_square, occupied) & targets;
+        if (bit64(from_square) & pinned_info) attacks &= COMPLETE_LINE[from_square][king_square];
+        count += popcount(attacks);
+        orthogonal &= orthogonal - 1;
+    }
+
+    // Unpinned pawns are shifted as a set; pinned ones keep only targets on their pin line.
+    uint64_t pawns = board.get_pieces(own_color, PieceType::PAWN);
+    uint64_t free_pawns = pawns & ~pinned_info;
+    auto forward = [](uint64_t bb) { return own_color == Color::WHITE ? bb << 8 : bb >> 8; };
+    uint64_t single_pushes = forward(free_pawns) & ~occupied;
+    uint64_t double_pushes = forward(single_pushes & double_push_rank) & ~occupied & remedy_mask;
+    single_pushes &= remedy_mask;
+    count += popcount(single_pushes) + 3 * popcount(single_pushes & promotion_rank_mask) + popcount(double_pushes);
+    // Each capture direction is counted separately so a square hit by two pawns counts twice
+    uint64_t west_captures = (own_color == Color::WHITE ? (free_pawns & NOT_FILE_A) << 7 : (free_pawns & NOT_FILE_A) >> 9) & enemy_pieces & remedy_mask;
+    uint64_t east_captures = (own_color == Color::WHITE ? (free_pawns & NOT_FILE_H) << 9 : (free_pawns & NOT_FILE_H) >> 7) & enemy_pieces & remedy_mask;
+    count += popcount(west_captures) + 3 * popcount(west_captures & promotion_rank_mask);
+    count += popcount(east_captures) + 3 * popcount(east_captures & promotion_rank_mask);
+
+    uint64_t pinned_pawns = pawns & pinned_info;
+    while (pinned_pawns) {
+        int from_square = get_lsb(pinned_pawns);
+        uint64_t pin_line = COMPLETE_LINE[from_square][king_square] & remedy_mask;
+        int to_square = from_square + push_step;
+        if (!(bit64(to_square) & occupied)) {
+            if (bit64(to_square) & pin_line) count += (bit64(to_square) & promotion_rank_mask) ? 4 : 1;
+            int to_square2 = to_square + push_step;
+            if ((bit64(to_square) & double_push_rank) && !(bit64(to_square2) & occupied) && (bit64(to_square2) & pin_line)) count++;
+        }
+        uint64_t capture_bb = PAWN_ATTACKS[to_int(own_color)][from_square] & enemy_pieces & pin_line;
+        count += popcount(capture_bb) + 3 * popcount(capture_bb & promotion_rank_mask);
+        pinned_pawns &= pinned_pawns - 1;
+    }
+
+    // En passant removes two pawns from one rank, so test the resulting occupancy directly
+    int ep_square = board.get_en_passant_rights();
+    if (ep_square != NO_SQUARE) {
+        int capture_square = ep_square - push_step;
+        if ((bit64(ep_square) | bit64(capture_square)) & remedy_mask) {
+            uint64_t rooks_queens = board.get_pieces(other_color, PieceType::ROOK) | board.get_pieces(other_color, PieceType::QUEEN);
+            uint64_t bishops_queens = board.get_pieces(other_color, PieceType::BISHOP) | board.get_pieces(other_color, PieceType::QUEEN);
+            uint64_t ep_pawns = PAWN_ATTACKS[to_int(other_color)][ep_square] & pawns;
+            while (ep_pawns) {
+                int from_square = get_lsb(ep_pawns);
+                uint64_t after = occupied ^ bit64(from_square) ^ bit64(capture_square) ^ bit64(ep_square);
+                if (!(get_rook_attacks(king_square, after) & rooks_queens) && !(get_bishop_attacks(king_square, after) & bishops_queens)) count++;
+                ep_pawns &= ep_pawns - 1;
+            }
+        }
+    }
+    return count;
+}
+
 void MoveGenerator::generate_captures(const Board& board, MoveList& moves){
     return generate_moves<true,false>(board,moves);
 }
 void MoveGenerator::generate_captures_with_checks(const Board& board,MoveList& moves){
     return generate_moves<true,true>(board,moves);
 }
+void MoveGenerator::generate_evasions(const Board& board, MoveList& moves) {
+    return generate_moves<false,false>(board, moves);
+}
 
 
 
@@ -1,6 +1,5 @@
 #include <string>
 #include <vector>
-#include <sstream>
 #include <iostream>
 #include "board.h"
 #include <stdexcept>
@@ -10,123 +9,176 @@
 #include "pst.h"
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <array>
 #include "attack_rays.h"
 #include "bitboard_masks.h"
 #include "evaluation.h"
 
 Board::Board(const std:: string& fen){
-    for (int c = 0; c < 2; ++c) {
-        for (int p = 0; p < 6; ++p) {
-            pieces[c][p] = 0;
-            color_pieces[c] = 0;
+    history.reserve(256);
+    if (set_fen(fen) != FenError::None) {
+        throw std::runtime_error("Invalid FEN string. FEN:" + fen);
+    }
+}
+namespace {
+    // Maps a FEN piece letter to its piece type, NONE for anything else.
+    constexpr PieceType fen_piece_type(char c) {
+        switch (c | 0x20) {
+            case 'p': return PieceType::PAWN;
+            case 'n': return PieceType::KNIGHT;
+            case 'b': return PieceType::BISHOP;
+            case 'r': return PieceType::ROOK;
+            case 'q': return PieceType::QUEEN;
+            case 'k': return PieceType::KING;
+            default: return PieceType::NONE;
         }
-     }
-    all_pieces = 0;
-    castling_rights = 0;
-    en_passant_square = NO_SQUARE;
-    game_phase = 0;
-    turn = to_int(Color::WHITE);
-    white_king_square = NO_SQUARE;
-    black_king_square = NO_SQUARE;
-    material_score = { 0,0 };
-    positional_score = { 0,0 };
-    half_moves = 0;
-    move_count = 1;
-     parse_fen(fen);
-     initialize_board();
-     initialize_game_phase();
-     zobrist_hash=initialize_hash();
-     pawn_key = initialize_pawn_key();
-     material_score=initialize_material_score();
-     positional_score=initialize_positional_score();
-     repetition_tracker.push(zobrist_hash);
-	 repetition_tracker.push(zobrist_hash);
-     history.reserve(256);
-     push_current_state_to_history();
-}
-void Board::parse_fen(const std::string& fen){
-    std::stringstream ss(fen);
-    std::string item;
-    std::vector<std::string> fen_parts;
-
-    while (std::getline(ss,item,' ')){
-        fen_parts.push_back(item);
-    }
-    if (fen_parts.size()==6){
-        
-    parse_fen_pieces(fen_parts[0]);
-     parse_fen_turn(fen_parts[1]);
-     parse_fen_castling(fen_parts[2]);
-     parse_fen_en_passant(fen_parts[3]);
-     parse_fen_half_move(fen_parts[4]);
-     parse_fen_move(fen_parts[5]);
+    }
+    constexpr int FEN_PHASE_WEIGHTS[6] = { 0, 1, 1, 2, 4, 0 };
 
-    }else{
-        throw std::runtime_error("Invalid FEN string: does not have 6 parts. FEN:"+fen);
+    // Parses an unsigned decimal field; returns false on an empty or non-numeric field or if it exceeds max_value.
+    bool parse_fen_number(std::string_view field, int max_value, int& value) {
+        if (field.empty()) return false;
+        int result = 0;
+        for (char c : field) {
+            if (c < '0' || c > '9') return false;
+            result = result * 10 + (c - '0');
+            if (result > max_value) return false;
+        }
+        value = result;
+        return true;
     }
 }
+// Single pass over the FEN: pieces, hashes, scores and phase are accumulated while the
+// placement field is read, and the board is only overwritten once the whole string is valid.
+// Missing half-move and full-move fields default to 0 and 1 (EPD style).
+FenError Board::set_fen(std::string_view fen) {
+    std::array<std::array<uint64_t, 6>, 2> new_pieces{};
+    std::array<uint64_t, 2> new_color_pieces{};
+    uint64_t hash = 0;
+    uint64_t new_pawn_key = 0;
+    uint64_t new_material_key = 0;
+    int king_squares[2] = { NO_SQUARE, NO_SQUARE };
+    int phase = 0;
+    EvaluationResult material = { 0,0 };
+    EvaluationResult positional = { 0,0 };
 
-void Board::parse_fen_pieces(const std::string& piece_data){
-    int rank=7;
-    int file=0;
-    for(char c : piece_data){
-        if (c=='/'){
-            rank--;
-            file=0;
-        } else if (isdigit(c)){
-            file+=(c-'0');
-        }else {
-            int square_index=rank*8+file;
-            int color_index=isupper(c) ? to_int(Color::WHITE):to_int(Color::BLACK);
-
-            int piece_type_index=to_int(PIECE_TYPE_MAP.at(toupper(c)));
+    size_t pos = 0;
+    auto next_field = [&]() {
+        while (pos < fen.size() && fen[pos] == ' ') ++pos;
+        size_t begin = pos;
+        while (pos < fen.size() && fen[pos] != ' ') ++pos;
+        return fen.substr(begin, pos - begin);
+    };
 
-            pieces[color_index][piece_type_index]|=(1ULL<< square_index);
+    // 1. Piece placement
+    std::string_view placement = next_field();
+    int rank = 7;
+    int file = 0;
+    for (char c : placement) {
+        if (c == '/') {
+            if (file != 8 || rank == 0) return FenError::Pieces;
+            rank--;
+            file = 0;
+        } else if (c >= '1' && c <= '8') {
+            file += c - '0';
+            if (file > 8) return FenError::Pieces;
+        } else {
+            PieceType piece_type = fen_piece_type(c);
+            if (piece_type == PieceType::NONE || file >= 8) return FenError::Pieces;
+            int color = (c >= 'a') ? to_int(Color::BLACK) : to_int(Color::WHITE);
+            int piece = to_int(piece_type);
+            int square = rank * 8 + file;
+            uint64_t key = Zobrist::piece_keys[color][piece][square];
 
+            new_material_key ^= Zobrist::piece_keys[color][piece][popcount(new_pieces[color][piece])];
+            new_pieces[color][piece] |= bit64(square);
+            new_color_pieces[color] |= bit64(square);
+            hash ^= key;
+            if (piece_type == PieceType::PAWN) {
+                new_pawn_key ^= key;
+            } else if (piece_type == PieceType::KING) {
+                if (king_squares[color] != NO_SQUARE) return FenError::Kings;
+                king_squares[color] = square;
+                new_pawn_key ^= key;
+            }
+            phase += FEN_PHASE_WEIGHTS[piece];
+            material += PACKED_PIECE_VALUES[color][piece];
+            positional += PACKED_PST[color][piece][square];
             file++;
+        }
+    }
+    if (rank != 0 || file != 8) return FenError::Pieces;
+    if (king_squares[0] == NO_SQUARE || king_squares[1] == NO_SQUARE) return FenError::Kings;
 
+    // 2. Side to move
+    std::string_view turn_field = next_field();
+    if (turn_field != "w" && turn_field != "b") return FenError::Turn;
+    int new_turn = turn_field[0] == 'w' ? to_int(Color::WHITE) : to_int(Color::BLACK);
+    if (new_turn == to_int(Color::BLACK)) hash ^= Zobrist::black_to_move_key;
 
-        }
-        if(c=='K' || c == 'k') {
-            if (isupper(c)){
-                white_king_square=rank*8+file-1;
-            }else{
-                black_king_square=rank*8+file-1;
+    // 3. Castling rights
+    std::string_view castling_field = next_field();
+    uint8_t new_castling_rights = 0;
+    if (castling_field.empty()) return FenError::Castling;
+    if (castling_field != "-") {
+        for (char c : castling_field) {
+            switch (c) {
+                case 'K': new_castling_rights |= WHITE_KING_CASTLE; break;
+                case 'Q': new_castling_rights |= WHITE_QUEEN_CASTLE; break;
+                case 'k': new_castling_rights |= BLACK_KING_CASTLE; break;
+                case 'q': new_castling_rights |= BLACK_QUEEN_CASTLE; break;
+                default: return FenError::Castling;
             }
-		}
+        }
     }
-}
+    hash ^= Zobrist::castling_keys[new_castling_rights];
 
-void Board::parse_fen_turn(const  std::string& turn_data){
-     turn= turn_data=="w" ? to_int(Color::WHITE):to_int(Color::BLACK); 
-}
-void Board::parse_fen_castling(const std::string& castling_data){
-	castling_rights = 0;
-    if (castling_data!="-"){
-		if (castling_data.find('K') != std::string::npos) castling_rights |= (1U << 3); // White kingside
-		if (castling_data.find('Q') != std::string::npos) castling_rights |= (1U << 2); // White queenside
-		if (castling_data.find('k') != std::string::npos) castling_rights |= (1U << 1); // Black kingside
-		if (castling_data.find('q') != std::string::npos) castling_rights |= (1U << 0); // Black queenside
+    // 4. En passant square
+    std::string_view en_passant_field = next_field();
+    int new_en_passant_square = NO_SQUARE;
+    if (en_passant_field.empty()) return FenError::EnPassant;
+    if (en_passant_field != "-") {
+        if (en_passant_field.size() != 2 || en_passant_field[0] < 'a' || en_passant_field[0] > 'h'
+            || (en_passant_field[1] != '3' && en_passant_field[1] != '6')) {
+            return FenError::EnPassant;
+        }
+        new_en_passant_square = (en_passant_field[1] - '1') * 8 + (en_passant_field[0] - 'a');
+        hash ^= Zobrist::en_passant_keys[new_en_passant_square % 8];
     }
-}
 
-void Board::parse_fen_en_passant(const std::string& en_passant_data){
-    if (en_passant_data == "-") {
-        en_passant_square = NO_SQUARE; 
-    } else {
-        // Character arithmetic is a fast way to get indices
-        int file = en_passant_data[0] - 'a'; // 'a' becomes 0, 'b' becomes 1, etc.
-        int rank = en_passant_data[1] - '1'; // '1' becomes 0, '2' becomes 1, etc.
-        
-        en_passant_square = rank * 8 + file;
-    }
-}
-void Board::parse_fen_half_move(const std::string& half_move_data){
-     half_moves=std::stoi(half_move_data);
-}
-void Board::parse_fen_move(const std::string& move_data){
-     move_count=std::stoi(move_data);
+    // 5. Move counters (optional, limited to the BoardState bit-field widths)
+    int new_half_moves = 0;
+    int new_move_count = 1;
+    std::string_view half_move_field = next_field();
+    if (!half_move_field.empty() && !parse_fen_number(half_move_field, 1023, new_half_moves)) return FenError::Counters;
+    std::string_view move_field = next_field();
+    if (!move_field.empty() && !parse_fen_number(move_field, 511, new_move_count)) return FenError::Counters;
+    if (!next_field().empty()) return FenError::Counters;
+
+    // Commit
+    pieces = new_pieces;
+    color_pieces = new_color_pieces;
+    all_pieces = new_color_pieces[0] | new_color_pieces[1];
+    white_king_square = king_squares[to_int(Color::WHITE)];
+    black_king_square = king_squares[to_int(Color::BLACK)];
+    turn = new_turn;
+    castling_rights = new_castling_rights;
+    en_passant_square = new_en_passant_square;
+    half_moves = new_half_moves;
+    move_count = new_move_count;
+    game_phase = phase;
+    zobrist_hash = hash;
+    pawn_key = new_pawn_key;
+    material_key = new_material_key;
+    material_score = material;
+    positional_score = positional;
+    check_squares_valid = false;
+    repetition_tracker.clear();
+    history.clear();
+    push_current_state_to_history();
+    refresh_accumulators();
+    return FenError::None;
 }
 void Board::display() const{
     std::cout<<"\n--- Current Position---"<< std::endl;
@@ -220,52 +272,63 @@ uint64_t Board::initialize_pawn_key() const {
 	pawn_key ^= Zobrist::piece_keys[to_int(Color::BLACK)][to_int(PieceType::KING)][black_king_square];
     return pawn_key;
 }
+// The material key hashes piece counts rather than squares: the n-th piece of a kind
+// contributes piece_keys[color][piece][n-1], so equal material gives equal keys.
+uint64_t Board::initialize_material_key() const {
+    uint64_t key = 0;
+    for (int color = 0; color < 2; ++color) {
+        for (int piece = 0; piece < 6; ++piece) {
+            int count = popcount(pieces[color][piece]);
+            for (int i = 0; i < count; ++i) {
+                key ^= Zobrist::piece_keys[color][piece][i];
+            }
+        }
+    }
+    return key;
+}
 EvaluationResult Board::initialize_material_score()const {
     EvaluationResult score = { 0,0 };
     for (int color=0;color<2;++color){
         for (int piece=0;piece<6;++piece){
-			score.mg_score += color == 0 ? popcount(pieces[color][piece]) * PIECE_VALUES_MG[piece] : -popcount(pieces[color][piece]) * PIECE_VALUES_MG[piece];
-			score.eg_score += color == 0 ? popcount(pieces[color][piece]) * PIECE_VALUES_EG[piece] : -popcount(pieces[color][piece]) * PIECE_VALUES_EG[piece];
+			score += popcount(pieces[color][piece]) * PACKED_PIECE_VALUES[color][piece];
         }
     }
     return score;
 }
 EvaluationResult Board::initialize_positional_score()const {
-        int16_t score_mg=0;
-        int16_t score_eg=0;
-        int16_t old_score_mg = 0;
-        int16_t old_score_eg = 0;
+        EvaluationResult score = { 0,0 };
         for (int color=0;color<2;++color){
             for (int piece=0;piece<6;++piece){
                 uint64_t bitboard=pieces[color][piece];
                 while (bitboard) {
                     int square = get_lsb(bitboard);
-                    if (color == 0) {
-                    score_mg += MG_PST[piece][square];
-                    score_eg += EG_PST[piece][square];
-                    }
-                    else {
-						score_mg -= MG_PST[piece][flip_square(square)];
-						score_eg -= EG_PST[piece][flip_square(square)];
-                    }
-
+                    score += PACKED_PST[color][piece][square];
                     bitboard &=bitboard-1;
                 }
 
             }
         }
-        return {score_mg,score_eg};
+        return score;
 }
+// Single colour dispatch; the helpers below are specialised so that colour-dependent
+// squares and directions are compile-time constants.
 void Board::make_move(const Move& move){
+    if (move.move_color == Color::WHITE) make_move_for<Color::WHITE>(move);
+    else make_move_for<Color::BLACK>(move);
+}
+template <Color Us>
+void Board::make_move_for(const Move& move){
     push_current_state_to_history();
-    update_material_score(move);
-    update_positional_score(move);
+    update_material_score<Us>(move);
+    update_positional_score<Us>(move);
     update_game_phase(move);
-    update_castle_rights(move );
-    update_en_passsant_rights(move);
-    update_king_square(move);
-    update_pieces(move);
-    update_pieces_hash(move);
+    update_castle_rights<Us>(move );
+    update_en_passsant_rights<Us>(move);
+    update_king_square<Us>(move);
+    update_material_key<Us>(move);
+    update_pieces<Us>(move);
+    if (!accumulators.empty()) update_accumulator<Us>(move);
+    update_pieces_hash<Us>(move);
     update_turn_rights(move);
     debug_check_pawn_key();
 	update_move_count(move);
@@ -274,28 +337,43 @@ void Board::make_move(const Move& move){
 void Board::undo_move(const Move& move){
     recover_board_state(history.back());
     history.pop_back();
+    if (!accumulators.empty()) accumulators.pop_back();
 	debug_check_pawn_key();
 }
+template <Color Us>
 void Board::update_material_score(const Move& move){
     if (move.piece_captured!=PieceType::NONE){
-        material_score-=get_piece_values(move.get_capture_color(),move.piece_captured);
+        material_score-=get_piece_values(flip_color(Us),move.piece_captured);
+    }
+    if (move.promotion_piece!=PieceType::NONE){
+        material_score+=get_piece_values(Us,move.promotion_piece);
+        material_score-=get_piece_values(Us,PieceType::PAWN);
+    }
+}
+// Must run before update_pieces so the piece counts are those of the position before the move.
+template <Color Us>
+void Board::update_material_key(const Move& move){
+    if (move.piece_captured!=PieceType::NONE){
+        int color=to_int(flip_color(Us));
+        int piece=to_int(move.piece_captured);
+        material_key^=Zobrist::piece_keys[color][piece][popcount(pieces[color][piece])-1];
     }
     if (move.promotion_piece!=PieceType::NONE){
-        material_score+=get_piece_values(move.move_color,move.promotion_piece);
-        material_score-=get_piece_values(move.move_color,PieceType::PAWN);
+        int color=to_int(Us);
+        int pawn=to_int(PieceType::PAWN);
+        int promoted=to_int(move.promotion_piece);
+        material_key^=Zobrist::piece_keys[color][pawn][popcount(pieces[color][pawn])-1];
+        material_key^=Zobrist::piece_keys[color][promoted][popcount(pieces[color][promoted])];
     }
 }
+template <Color Us>
 void Board::update_positional_score(const Move& move){
     PieceType piece_moved=move.piece_moved;
     PieceType piece_reached=move.promotion_piece==PieceType::NONE ? move.piece_moved:move.promotion_piece;
-    positional_score.mg_score-=get_mg_pos_score(move.move_color,piece_moved,move.from_square);
-    positional_score.mg_score+=get_mg_pos_score(move.move_color,piece_reached,move.to_square);
-    
-    positional_score.eg_score-=get_eg_pos_score(move.move_color,piece_moved,move.from_square);
-    positional_score.eg_score+=get_eg_pos_score(move.move_color,piece_reached,move.to_square);
+    positional_score-=get_pos_score(Us,piece_moved,move.from_square);
+    positional_score+=get_pos_score(Us,piece_reached,move.to_square);
     if (move.piece_captured!=PieceType::NONE){
-        positional_score.mg_score-=get_mg_pos_score(move.get_capture_color(),move.piece_captured,move.get_capture_square());
-        positional_score.eg_score-=get_eg_pos_score(move.get_capture_color(),move.piece_captured,move.get_capture_square());
+        positional_score-=get_pos_score(flip_color(Us),move.piece_captured,move.get_capture_square());
     }
     if (move.is_castle)
     {
@@ -303,12 +381,8 @@ void Board::update_positional_score(const Move& move){
         int old_rook_square=king_side ? move.to_square+1:move.to_square-2;
         int new_rook_square=king_side ? move.to_square-1:move.to_square+1;
 
-        positional_score.mg_score-=get_mg_pos_score(move.move_color,PieceType::ROOK,old_rook_square);
-        positional_score.mg_score+=get_mg_pos_score(move.move_color,PieceType::ROOK,new_rook_square);
-
-        
-        positional_score.eg_score-=get_eg_pos_score(move.move_color,PieceType::ROOK,old_rook_square);
-        positional_score.eg_score+=get_eg_pos_score(move.move_color,PieceType::ROOK,new_rook_square);
+        positional_score-=get_pos_score(Us,PieceType::ROOK,old_rook_square);
+        positional_score+=get_pos_score(Us,PieceType::ROOK,new_rook_square);
 
     }
     
@@ -331,13 +405,14 @@ void Board::update_game_phase(const Move& move){
         game_phase+=piece_weight;
     }
 }
+template <Color Us>
 void Board::update_castle_rights(const Move& move){
     this->zobrist_hash ^= Zobrist::castling_keys[this->castling_rights]; // Remove old rights from hash
 
         // if King moves
     if (move.piece_moved==PieceType::KING)
     {
-        if (move.move_color==Color::WHITE)
+        if constexpr (Us==Color::WHITE)
         {  
             castling_rights &= ~WHITE_KING_CASTLE;
 			castling_rights &= ~WHITE_QUEEN_CASTLE;
@@ -364,6 +439,7 @@ void Board::update_castle_rights(const Move& move){
 
 	this->zobrist_hash ^= Zobrist::castling_keys[this->castling_rights]; // Add new rights to hash
 }
+template <Color Us>
 void Board::update_en_passsant_rights(const Move& move){
     
         if (en_passant_square != NO_SQUARE) {
@@ -372,7 +448,7 @@ void Board::update_en_passsant_rights(const Move& move){
         en_passant_square=NO_SQUARE;
         if (move.is_double_pawn_move())
         {
-            en_passant_square=move.move_color==Color::WHITE ? move.to_square-8:move.to_square+8;
+            en_passant_square=Us==Color::WHITE ? move.to_square-8:move.to_square+8;
         }
         if (en_passant_square != NO_SQUARE) {
             zobrist_hash ^= Zobrist::en_passant_keys[en_passant_square % 8];
@@ -382,9 +458,10 @@ void Board::update_en_passsant_rights(const Move& move){
     
     
 }
+template <Color Us>
 void Board::update_pieces_hash(const Move& move){
     PieceType piece_reached= move.promotion_piece==PieceType::NONE? move.piece_moved:move.promotion_piece;
-    int move_color=to_int(move.move_color);
+    int move_color=to_int(Us);
     zobrist_hash^=Zobrist::piece_keys[move_color][to_int(move.piece_moved)][move.from_square];
     zobrist_hash^=Zobrist::piece_keys[move_color][to_int(piece_reached)][move.to_square];
     if(move.piece_moved==PieceType::PAWN || move.piece_moved==PieceType::KING){
@@ -396,8 +473,8 @@ void Board::update_pieces_hash(const Move& move){
 
     if (move.piece_captured!=PieceType::NONE)
     {
-        int other_color=to_int(move.get_capture_color());
-        int capture_square=move.is_en_passant ? (move.move_color==Color::WHITE ? move.to_square-8:move.to_square+8):move.to_square;
+        int other_color=to_int(flip_color(Us));
+        int capture_square=move.is_en_passant ? (Us==Color::WHITE ? move.to_square-8:move.to_square+8):move.to_square;
         zobrist_hash^=Zobrist::piece_keys[other_color][to_int(move.piece_captured)][capture_square];
         if (move.piece_captured==PieceType::PAWN){
             pawn_key^=Zobrist::piece_keys[other_color][to_int(move.piece_captured)][capture_square];
@@ -416,11 +493,12 @@ void Board::update_pieces_hash(const Move& move){
     
     
 }
+template <Color Us>
 void Board::update_king_square(const Move& move){
     
         if (move.piece_moved==PieceType::KING)
         {
-            if (move.move_color==Color::WHITE)
+            if constexpr (Us==Color::WHITE)
             {
                 white_king_square=move.to_square;
             }else
@@ -432,20 +510,21 @@ void Board::update_king_square(const Move& move){
     
     
 }
+template <Color Us>
 void Board::update_pieces(const Move& move){
     PieceType piece_reached= move.promotion_piece==PieceType::NONE ? move.piece_moved: move.promotion_piece;
-    pieces[to_int(move.move_color)][to_int(move.piece_moved)]^=1ULL<< move.from_square;
-    color_pieces[to_int(move.move_color)]^=1ULL<<move.from_square;
+    pieces[to_int(Us)][to_int(move.piece_moved)]^=1ULL<< move.from_square;
+    color_pieces[to_int(Us)]^=1ULL<<move.from_square;
     all_pieces^=1ULL<<move.from_square;
 
-    pieces[to_int(move.move_color)][to_int(piece_reached)]^=1ULL<< move.to_square;
-    color_pieces[to_int(move.move_color)]^=1ULL<<move.to_square;
+    pieces[to_int(Us)][to_int(piece_reached)]^=1ULL<< move.to_square;
+    color_pieces[to_int(Us)]^=1ULL<<move.to_square;
     all_pieces^=1ULL<<move.to_square;
     
     if (move.piece_captured!=PieceType::NONE)
     {   
-        Color other_color=move.get_capture_color();
-        int capture_square=move.is_en_passant ? (move.move_color==Color::WHITE ? move.to_square-8:move.to_square+8):move.to_square;
+        Color other_color=flip_color(Us);
+        int capture_square=move.is_en_passant ? (Us==Color::WHITE ? move.to_square-8:move.to_square+8):move.to_square;
         
         pieces[to_int(other_color)][to_int(move.piece_captured)]^=1ULL<< capture_square;
         color_pieces[to_int(other_color)]^=1ULL<<capture_square;
@@ -460,8 +539,8 @@ void Board::update_pieces(const Move& move){
         int new_rook_square= king_side ? move.to_square-1:move.to_square+1;
 
         
-        pieces[to_int(move.move_color)][to_int(PieceType::ROOK)]^=1ULL<<old_rook_square| 1ULL<<new_rook_square;
-        color_pieces[to_int(move.move_color)]^=1ULL<<old_rook_square| 1ULL<<new_rook_square;
+        pieces[to_int(Us)][to_int(PieceType::ROOK)]^=1ULL<<old_rook_square| 1ULL<<new_rook_square;
+        color_pieces[to_int(Us)]^=1ULL<<old_rook_square| 1ULL<<new_rook_square;
         all_pieces^=1ULL<<old_rook_square|1ULL<<new_rook_square;
     }
     
@@ -471,6 +550,40 @@ void Board::update_pieces(const Move& move){
 
 
 
+}
+template <Color Us>
+void Board::update_accumulator(const Move& move){
+    PieceType piece_reached= move.promotion_piece==PieceType::NONE ? move.piece_moved: move.promotion_piece;
+    nnue::FeatureChange added[2];
+    nnue::FeatureChange removed[2];
+    int added_count = 0;
+    int removed_count = 0;
+
+    removed[removed_count++] = { Us, move.piece_moved, move.from_square };
+    added[added_count++] = { Us, piece_reached, move.to_square };
+    if (move.piece_captured!=PieceType::NONE){
+        int capture_square=move.is_en_passant ? (Us==Color::WHITE ? move.to_square-8:move.to_square+8):move.to_square;
+        removed[removed_count++] = { flip_color(Us), move.piece_captured, capture_square };
+    }
+    if (move.is_castle){
+        bool king_side= move.to_square>move.from_square;
+        int old_rook_square=king_side ? move.to_square+1: move.to_square-2;
+        int new_rook_square= king_side ? move.to_square-1:move.to_square+1;
+        removed[removed_count++] = { Us, PieceType::ROOK, old_rook_square };
+        added[added_count++] = { Us, PieceType::ROOK, new_rook_square };
+    }
+
+    // emplace_back may reallocate, so index the previous entry only afterwards
+    accumulators.emplace_back();
+    const size_t top = accumulators.size() - 1;
+    nnue::update(accumulators[top], accumulators[top - 1], added, added_count, removed, removed_count);
+}
+void Board::refresh_accumulators(){
+    accumulators.clear();
+    if (!nnue::is_enabled()) return;
+    accumulators.reserve(std::max<size_t>(256, history.capacity()));
+    accumulators.emplace_back();
+    nnue::refresh(accumulators.back(), pieces);
 }
 void Board::update_move_count(const Move& move){
     if (turn==to_int(Color::BLACK)){
@@ -487,12 +600,22 @@ void Board::update_move_count(const Move& move){
 void Board::update_repetition_tracker() {
 
     if (half_moves == 0) {
-        repetition_tracker.reset(zobrist_hash);
+        repetition_tracker.clear();
     }
     else {
-        repetition_tracker.push(zobrist_hash);
+        repetition_tracker.record(count_repetitions());
     }
 }
+uint8_t Board::count_repetitions() const {
+    // history[size - d] holds the position d plies ago; only same-side positions can match
+    const int size = static_cast<int>(history.size());
+    const int limit = std::min(half_moves, size - 1);
+    uint8_t count = 1;
+    for (int d = 2; d <= limit; d += 2) {
+        if (history[size - d].zobrist_hash == zobrist_hash && ++count == 3) break;
+    }
+    return count;
+}
 CheckInfo Board::count_attacker_on_square(const int square, const Color attacker_color,const int bound,const bool need_square)const {
     CheckInfo info={0,NO_SQUARE};
     int other_color=attacker_color==Color::BLACK ? to_int(Color::WHITE):to_int(Color::BLACK);
@@ -617,6 +740,7 @@ BoardState Board::get_board_state() const {
     BoardState current_state;
     current_state.zobrist_hash=this->zobrist_hash;
     current_state.pawn_key = this->pawn_key;
+    current_state.material_key = this->material_key;
     current_state.castling_rights=this->castling_rights;
     current_state.en_passant_square = this->en_passant_square;
     current_state.game_phase = this->game_phase;
@@ -630,8 +754,9 @@ BoardState Board::get_board_state() const {
     current_state.material_score = this->material_score;
     current_state.half_moves = this->half_moves;
     current_state.move_count = this->move_count;
-    current_state.current_twofold_count = this->repetition_tracker.get_twofold();
-	current_state.current_repetition_tracker_start = this->repetition_tracker.get_start();
+    current_state.repetition_count = this->repetition_tracker.current_count;
+    current_state.twofold_positions = this->repetition_tracker.twofold_positions;
+    current_state.threefold_positions = this->repetition_tracker.threefold_positions;
     return current_state;
 }
 void Board::push_current_state_to_history() {
@@ -639,6 +764,7 @@ void Board::push_current_state_to_history() {
     BoardState& current_state = history.back();
     current_state.zobrist_hash = this->zobrist_hash;
     current_state.pawn_key = this->pawn_key;
+    current_state.material_key = this->material_key;
     current_state.castling_rights = this->castling_rights;
     current_state.en_passant_square = this->en_passant_square;
     current_state.game_phase = this->game_phase;
@@ -652,8 +778,9 @@ void Board::push_current_state_to_history() {
     current_state.material_score = this->material_score;
     current_state.half_moves = this->half_moves;
     current_state.move_count = this->move_count;
-	current_state.current_twofold_count = this->repetition_tracker.get_twofold();
-	current_state.current_repetition_tracker_start = this->repetition_tracker.get_start();
+    current_state.repetition_count = this->repetition_tracker.current_count;
+    current_state.twofold_positions = this->repetition_tracker.twofold_positions;
+    current_state.threefold_positions = this->repetition_tracker.threefold_positions;
 }
 bool Board::has_enough_material_for_nmp() const {
     // Get the bitboard of all non-pawn/king pieces for the current side to move
@@ -691,6 +818,84 @@ bool Board::in_check() const {
     if (queens & queen_attacks) return true;
     return false;
 }
+bool Board::gives_check(const Move& move) const {
+    const CheckSquares& cs = get_check_squares();
+    int from = move.from_square;
+    int to = move.to_square;
+
+    // Direct check: the piece standing on to_square attacks the enemy king
+    if (move.promotion_piece == PieceType::NONE) {
+        if (cs.squares[to_int(move.piece_moved)] & bit64(to)) return true;
+    }
+    else if (get_piece_attacks(move.promotion_piece, to, all_pieces ^ bit64(from)) & bit64(cs.king_square)) {
+        return true;
+    }
+
+    // Discovered check: a blocker leaves the line between our slider and their king
+    if ((cs.discovered_blockers & bit64(from)) && (COMPLETE_LINE[from][cs.king_square] & bit64(to)) == 0) return true;
+
+    // Castling and en passant move a second piece, so test the resulting occupancy directly
+    if (move.is_castle || move.is_en_passant) {
+        int us = to_int(move.move_color);
+        uint64_t occupancy = all_pieces ^ bit64(from) ^ bit64(to);
+        uint64_t rooks_queens = pieces[us][to_int(PieceType::ROOK)] | pieces[us][to_int(PieceType::QUEEN)];
+        uint64_t bishops_queens = pieces[us][to_int(PieceType::BISHOP)] | pieces[us][to_int(PieceType::QUEEN)];
+        if (move.is_castle) {
+            bool king_side = to > from;
+            int old_rook_square = king_side ? to + 1 : to - 2;
+            int new_rook_square = king_side ? to - 1 : to + 1;
+            occupancy ^= bit64(old_rook_square) | bit64(new_rook_square);
+            rooks_queens ^= bit64(old_rook_square) | bit64(new_rook_square);
+        }
+        else {
+            occupancy ^= bit64(move.get_capture_square());
+        }
+        return (get_rook_attacks(cs.king_square, occupancy) & rooks_queens) ||
+               (get_bishop_attacks(cs.king_square, occupancy) & bishops_queens);
+    }
+    return false;
+}
+const CheckSquares& Board::get_check_squares() const {
+    if (!check_squares_valid || check_squares_key != zobrist_hash) {
+        compute_check_squares();
+    }
+    return check_squares;
+}
+void Board::compute_check_squares() const {
+    Color us = get_turn();
+    Color them = flip_color(us);
+    int king_sq = get_king_square(them);
+    uint64_t bishop_attacks = get_bishop_attacks(king_sq, all_pieces);
+    uint64_t rook_attacks = get_rook_attacks(king_sq, all_pieces);
+
+    check_squares.king_square = king_sq;
+    check_squares.squares[to_int(PieceType::PAWN)] = PAWN_ATTACKS[to_int(them)][king_sq];
+    check_squares.squares[to_int(PieceType::KNIGHT)] = KNIGHT_ATTACKS[king_sq];
+    check_squares.squares[to_int(PieceType::BISHOP)] = bishop_attacks;
+    check_squares.squares[to_int(PieceType::ROOK)] = rook_attacks;
+    check_squares.squares[to_int(PieceType::QUEEN)] = bishop_attacks | rook_attacks;
+    check_squares.squares[to_int(PieceType::KING)] = 0;
+    check_squares.discovered_blockers = get_slider_blockers(king_sq, us, us);
+
+    check_squares_key = zobrist_hash;
+    check_squares_valid = true;
+}
+uint64_t Board::get_slider_blockers(int king_square, Color blocker_color, Color slider_color) const {
+    int s = to_int(slider_color);
+    uint64_t snipers = (ROOK_ATTACKS[king_square] & (pieces[s][to_int(PieceType::ROOK)] | pieces[s][to_int(PieceType::QUEEN)]))
+                     | (BISHOP_ATTACKS[king_square] & (pieces[s][to_int(PieceType::BISHOP)] | pieces[s][to_int(PieceType::QUEEN)]));
+    uint64_t blockers = 0;
+    while (snipers) {
+        int sniper_sq = get_lsb(snipers);
+        uint64_t between = LINE_BETWEEN[king_square][sniper_sq] & all_pieces & ~(bit64(king_square) | bit64(sniper_sq));
+        // Exactly one piece on the ray
+        if (between && (between & (between - 1)) == 0) {
+            blockers |= between & color_pieces[to_int(blocker_color)];
+        }
+        snipers &= snipers - 1;
+    }
+    return blockers;
+}
 int Board::make_null_move(){
     int original_ep_square=en_passant_square;
 
@@ -698,6 +903,8 @@ int Board::make_null_move(){
     en_passant_square=NO_SQUARE;
     turn= turn==0 ? 1:0;
     zobrist_hash^=Zobrist::black_to_move_key;
+    // The position after a null move has never occurred with this side to move in the window
+    repetition_tracker.current_count = 1;
     return original_ep_square;
 }
 void Board::undo_null_move(int original_ep_square){
@@ -706,13 +913,16 @@ void Board::undo_null_move(int original_ep_square){
         en_passant_square=original_ep_square;
 
         if (en_passant_square!=NO_SQUARE) zobrist_hash^=Zobrist::en_passant_keys[en_passant_square % 8];
-        
+        repetition_tracker.current_count = count_repetitions();
 }
 void Board::recover_board_state(const BoardState& previous_state) {
 
-    this->repetition_tracker.recover_from_old(zobrist_hash,previous_state.current_repetition_tracker_start, previous_state.current_twofold_count);
+    this->repetition_tracker.current_count = previous_state.repetition_count;
+    this->repetition_tracker.twofold_positions = previous_state.twofold_positions;
+    this->repetition_tracker.threefold_positions = previous_state.threefold_positions;
     this->zobrist_hash = previous_state.zobrist_hash;
 	this->pawn_key = previous_state.pawn_key;
+	this->material_key = previous_state.material_key;
     this->castling_rights = previous_state.castling_rights;
     this->en_passant_square = previous_state.en_passant_square;
     this->game_phase = previous_state.game_phase;
@@ -728,10 +938,10 @@ void Board::recover_board_state(const BoardState& previous_state) {
     this->move_count = previous_state.move_count;
 }
 bool Board::is_repetition_draw(int repeat) const {
-	return repetition_tracker.count(zobrist_hash) >= repeat;
+	return repetition_tracker.count() >= repeat;
 }
 int Board::get_position_repeat_count() const {
-	return repetition_tracker.count(zobrist_hash);
+	return repetition_tracker.count();
 }
 bool Board::any_appeared_more_than(int count) const {
         if (count==2) {
@@ -751,15 +961,7 @@ void Board::reserve_history(size_t size){
 // In your board.cpp file
 uint64_t Board::get_pawn_attacks_for_color(Color color) const {
     uint64_t pawns = pieces[to_int(color)][to_int(PieceType::PAWN)];
-    uint64_t attacks = 0;
-    if(Color::WHITE == color) {
-        attacks |= (pawns << 7) & NOT_FILE_H; // Capture to the left
-        attacks |= (pawns << 9) & NOT_FILE_A; // Capture to the right
-    } else {
-        attacks |= (pawns >> 9) & NOT_FILE_H; // Capture to the left
-        attacks |= (pawns >> 7) & NOT_FILE_A; // Capture to the right
-	}
-    return attacks;
+    return get_pawn_attacks(pawns, color);
 }
 uint64_t Board::get_knight_attacks_for_color(Color color) const {
     uint64_t knights = pieces[to_int(color)][to_int(PieceType::KNIGHT)];
@@ -822,6 +1024,7 @@ uint64_t Board::get_attacks_for_color(Color color) const {
 Board::Board(const Board& other)
     : zobrist_hash(other.zobrist_hash), 
 	pawn_key(other.pawn_key),
+	material_key(other.material_key),
     castling_rights(other.castling_rights),
 	en_passant_square(other.en_passant_square),
 	game_phase(other.game_phase),
@@ -839,6 +1042,11 @@ Board::Board(const Board& other)
 {
 	history.reserve(std::max<size_t>(256, other.history.size()));
     history.insert(history.end(), other.history.begin(), other.history.end());
+    // Searches never undo past their root, so only the current accumulator is needed
+    if (!other.accumulators.empty()) {
+        accumulators.reserve(256);
+        accumulators.push_back(other.accumulators.back());
+    }
 }
 const std::vector<BoardState>& Board::get_history() const {
     return history;
@@ -855,6 +1063,9 @@ uint64_t Board::get_zobrist_hash() const {
 uint64_t Board::get_pawn_key() const {
     return pawn_key;
 }
+uint64_t Board::get_material_key() const {
+    return material_key;
+}
 void Board::debug_check_pawn_key() const {
 #ifdef _DEBUG
     uint64_t full_pawn_key = initialize_pawn_key();
@@ -864,6 +1075,21 @@ void Board::debug_check_pawn_key() const {
     }
 #endif
 }
+const char* Board::find_incremental_mismatch() const {
+    if (initialize_hash() != zobrist_hash) return "zobrist";
+    if (initialize_pawn_key() != pawn_key) return "pawn_key";
+    if (initialize_material_key() != material_key) return "material_key";
+    EvaluationResult material = initialize_material_score();
+    if (material != material_score) return "material_score";
+    EvaluationResult positional = initialize_positional_score();
+    if (positional != positional_score) return "positional_score";
+    if (!accumulators.empty()) {
+        nnue::Accumulator refreshed;
+        nnue::refresh(refreshed, pieces);
+        if (std::memcmp(&refreshed, &accumulators.back(), sizeof(refreshed)) != 0) return "nnue_accumulator";
+    }
+    return nullptr;
+}
 bool Board::is_white_to_move() const {
     return turn == to_int(Color::WHITE);
 }
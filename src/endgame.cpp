@@ -0,0 +1,207 @@
+#include "endgame.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <unordered_map>
+#include "adjustable_parameters.h"
+#include "bitboard_masks.h"
+#include "kpk_bitbase.h"
+#include "zobrist.h"
+
+namespace endgame {
+namespace {
+    constexpr const char* PIECE_LETTERS = "PNBRQK";
+    // Classical values for the material thresholds; the tuned PIECE_VALUES do not order the pieces
+    constexpr int NON_PAWN_VALUES[6] = { 0, 320, 330, 500, 900, 0 };
+    constexpr int BISHOP_VALUE = NON_PAWN_VALUES[to_int(PieceType::BISHOP)];
+    constexpr int ROOK_VALUE = NON_PAWN_VALUES[to_int(PieceType::ROOK)];
+
+    int count(const Board& board, Color color, PieceType piece) {
+        return popcount(board.get_pieces(color, piece));
+    }
+    int non_pawn_material(const Board& board, Color color) {
+        int material = 0;
+        for (PieceType piece : { PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK, PieceType::QUEEN }) {
+            material += count(board, color, piece) * NON_PAWN_VALUES[to_int(piece)];
+        }
+        return material;
+    }
+    bool is_bare_king(const Board& board, Color color) {
+        return board.get_color_pieces(color) == board.get_pieces(color, PieceType::KING);
+    }
+    bool has_mating_material(const Board& board, Color color) {
+        int bishops = count(board, color, PieceType::BISHOP);
+        return count(board, color, PieceType::QUEEN) > 0 || count(board, color, PieceType::ROOK) > 0
+            || bishops >= 2 || (bishops > 0 && count(board, color, PieceType::KNIGHT) > 0);
+    }
+    int from_strong_side(Color strong, int value) {
+        return strong == Color::WHITE ? value : -value;
+    }
+
+    // 10 in the centre up to 130 in the corners
+    int push_to_edge(int square) {
+        int file = square % 8;
+        int rank = square / 8;
+        return 20 * (std::max(3 - file, file - 4) + std::max(3 - rank, rank - 4)) + 10;
+    }
+    int push_close(int square1, int square2) {
+        return 140 - 20 * king_distance(square1, square2);
+    }
+    // Only the two corners of the bishop's colour can be mated in
+    int push_to_bishop_corner(int square, bool light_bishop) {
+        int corner1 = light_bishop ? 56 : 0;
+        int corner2 = light_bishop ? 7 : 63;
+        return 200 - 25 * std::min(king_distance(square, corner1), king_distance(square, corner2));
+    }
+
+    int evaluate_draw(const Board&) {
+        return 0;
+    }
+
+    // Lone king against mating material: drive it to the edge and follow it with our own king
+    template <Color Strong>
+    int evaluate_kxk(const Board& board) {
+        constexpr Color Weak = flip_color(Strong);
+        int strong_king = board.get_king_square(Strong);
+        int weak_king = board.get_king_square(Weak);
+        int value = KNOWN_WIN + std::abs(board.get_material_score().eg_score())
+            + push_to_edge(weak_king) + push_close(strong_king, weak_king);
+        return from_strong_side(Strong, value);
+    }
+
+    template <Color Strong>
+    int evaluate_kbnk(const Board& board) {
+        constexpr Color Weak = flip_color(Strong);
+        int strong_king = board.get_king_square(Strong);
+        int weak_king = board.get_king_square(Weak);
+        bool light_bishop = (board.get_pieces(Strong, PieceType::BISHOP) & LIGHT_SQUARES) != 0;
+        int value = KNOWN_WIN + std::abs(board.get_material_score().eg_score())
+            + push_close(strong_king, weak_king) + push_to_bishop_corner(weak_king, light_bishop);
+        return from_strong_side(Strong, value);
+    }
+
+    // Exact by the bitbase; a win is ranked by how far the pawn has advanced
+    template <Color Strong>
+    int evaluate_kpk(const Board& board) {
+        constexpr Color Weak = flip_color(Strong);
+        int pawn = get_lsb(board.get_pieces(Strong, PieceType::PAWN));
+        if (!kpk::probe(Strong, board.get_king_square(Strong), pawn, board.get_king_square(Weak), board.get_turn())) {
+            return 0;
+        }
+        int relative_rank = Strong == Color::WHITE ? pawn / 8 : 7 - pawn / 8;
+        return from_strong_side(Strong, KNOWN_WIN + PIECE_VALUES_EG[to_int(PieceType::PAWN)] + 10 * relative_rank);
+    }
+
+    template <int Factor>
+    int fixed_scale(const Board&) {
+        return Factor;
+    }
+    // Bishops and pawns only: on opposite colours the defender blockades on the other colour
+    int scale_opposite_bishops(const Board& board) {
+        bool white_light = (board.get_pieces(Color::WHITE, PieceType::BISHOP) & LIGHT_SQUARES) != 0;
+        bool black_light = (board.get_pieces(Color::BLACK, PieceType::BISHOP) & LIGHT_SQUARES) != 0;
+        return white_light != black_light ? SCALE_NORMAL / 4 : SCALE_NORMAL;
+    }
+    // Bishop and rook pawns against a bare king: drawn once the king holds a corner the bishop cannot cover
+    template <Color Strong>
+    int scale_wrong_bishop(const Board& board) {
+        uint64_t pawns = board.get_pieces(Strong, PieceType::PAWN);
+        bool a_file = (pawns & ~FILE_MASK[0]) == 0;
+        bool h_file = (pawns & ~FILE_MASK[7]) == 0;
+        if (!a_file && !h_file) return SCALE_NORMAL;
+        int promotion = (a_file ? 0 : 7) + (Strong == Color::WHITE ? 56 : 0);
+        uint64_t promotion_colour = (bit64(promotion) & LIGHT_SQUARES) != 0 ? LIGHT_SQUARES : DARK_SQUARES;
+        if (board.get_pieces(Strong, PieceType::BISHOP) & promotion_colour) return SCALE_NORMAL;
+        return king_distance(board.get_king_square(flip_color(Strong)), promotion) <= 1 ? SCALE_DRAW : SCALE_NORMAL;
+    }
+
+    // Value functions keyed by the exact material signature, both colours registered
+    struct Registry {
+        std::unordered_map<uint64_t, EndgameEvalFn> values;
+
+        Registry() {
+            add("KPK", evaluate_kpk<Color::WHITE>, evaluate_kpk<Color::BLACK>);
+            add("KBNK", evaluate_kbnk<Color::WHITE>, evaluate_kbnk<Color::BLACK>);
+            add("KNNK", evaluate_draw, evaluate_draw);
+        }
+        void add(const char* code, EndgameEvalFn white_strong, EndgameEvalFn black_strong) {
+            values[material_key(code, Color::WHITE)] = white_strong;
+            values[material_key(code, Color::BLACK)] = black_strong;
+        }
+    };
+    const Registry& registry() {
+        static const Registry instance;
+        return instance;
+    }
+
+    template <Color Strong>
+    void add_generic_rules(const Board& board, Functions& functions) {
+        constexpr Color Weak = flip_color(Strong);
+        if (!functions.value && is_bare_king(board, Weak) && has_mating_material(board, Strong)) {
+            functions.value = evaluate_kxk<Strong>;
+        }
+
+        int strong_pawns = count(board, Strong, PieceType::PAWN);
+        int strong_material = non_pawn_material(board, Strong);
+        int weak_material = non_pawn_material(board, Weak);
+        EndgameScaleFn& scale = functions.scale[to_int(Strong)];
+        if (strong_pawns == 0 && strong_material - weak_material <= BISHOP_VALUE) {
+            // Without pawns a minor piece up is not enough to win
+            scale = strong_material < ROOK_VALUE ? fixed_scale<SCALE_DRAW>
+                : weak_material <= BISHOP_VALUE ? fixed_scale<4> : fixed_scale<14>;
+        }
+        else if (strong_pawns > 0 && is_bare_king(board, Weak)
+            && strong_material == count(board, Strong, PieceType::BISHOP) * BISHOP_VALUE) {
+            scale = scale_wrong_bishop<Strong>;
+        }
+        else if (strong_material == BISHOP_VALUE && weak_material == BISHOP_VALUE
+            && count(board, Strong, PieceType::BISHOP) == 1 && count(board, Weak, PieceType::BISHOP) == 1) {
+            scale = scale_opposite_bishops;
+        }
+    }
+}
+
+uint64_t material_key(const char* code, Color strong) {
+    int counts[2][6] = {};
+    int side = to_int(strong);
+    for (const char* c = code; *c; ++c) {
+        // The second king starts the weak side's pieces
+        if (*c == 'K' && c != code) side ^= 1;
+        counts[side][std::strchr(PIECE_LETTERS, *c) - PIECE_LETTERS]++;
+    }
+    uint64_t key = 0;
+    for (int color = 0; color < 2; ++color) {
+        for (int piece = 0; piece < 6; ++piece) {
+            for (int i = 0; i < counts[color][piece]; ++i) {
+                key ^= Zobrist::piece_keys[color][piece][i];
+            }
+        }
+    }
+    return key;
+}
+
+bool is_kpk(const Board& board) {
+    static const uint64_t keys[2] = { material_key("KPK", Color::WHITE), material_key("KPK", Color::BLACK) };
+    uint64_t key = board.get_material_key();
+    return key == keys[0] || key == keys[1];
+}
+
+Functions lookup(const Board& board) {
+    Functions functions;
+    const auto& values = registry().values;
+    if (auto it = values.find(board.get_material_key()); it != values.end()) {
+        functions.value = it->second;
+    }
+
+    // Bare kings, or a single minor piece against a bare king, can never be won
+    int pawns = count(board, Color::WHITE, PieceType::PAWN) + count(board, Color::BLACK, PieceType::PAWN);
+    int material = non_pawn_material(board, Color::WHITE) + non_pawn_material(board, Color::BLACK);
+    if (!functions.value && pawns == 0 && material <= BISHOP_VALUE) {
+        functions.value = evaluate_draw;
+    }
+
+    add_generic_rules<Color::WHITE>(board, functions);
+    add_generic_rules<Color::BLACK>(board, functions);
+    return functions;
+}
+}
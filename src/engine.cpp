@@ -16,6 +16,7 @@
 #include <algorithm>
 #include "adjustable_parameters.h"
 #include "uci_helpers.h"
+#include "kpk_bitbase.h"
 void ThreadLocalData::flush_counters(Engine* engine) {
     if (nodes > 10000) {
         engine->nodes.fetch_add(nodes, std::memory_order_relaxed);
@@ -30,6 +31,7 @@ static thread_local ThreadLocalData tls_data;
 constexpr int PIECE_VALUES_QU[7] = {100,320,320,500,900,10000,0};
 
 Engine::Engine(size_t tt_size_mb){
+    kpk::init();
     init_tt(tt_size_mb);
     int thread_count = std::thread::hardware_concurrency();
     start_thread_pool(thread_count);
@@ -74,6 +76,10 @@ SearchResult Engine::negamax(Board& board, int depth, int alpha, int beta, int p
     
     if (depth==0)
     {
+        // The KPK bitbase already knows the result, so there is nothing for quiescence to resolve
+        if (endgame::is_kpk(board)) {
+            return { board.is_white_to_move() ? evaluate(board) : -evaluate(board), Move() };
+        }
         int q_score=quiescence_search(board,alpha,beta,0,tls);
         
         return {q_score,Move()};
@@ -86,7 +92,7 @@ SearchResult Engine::negamax(Board& board, int depth, int alpha, int beta, int p
 	int rfp_max_depth = 5;
 	bool is_pv_node = (beta - alpha) > 1;
     if(!king_is_in_check && depth <= rfp_max_depth&& std::abs(beta)<MATE_THRESHOLD && !is_pv_node) {
-        static_eval = board.is_white_to_move() ? evaluate(board, EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE) : -evaluate(board, EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE);
+        static_eval = board.is_white_to_move() ? evaluate<EvalCheap>(board) : -evaluate<EvalCheap>(board);
 		int rfp_margin = 112 * depth; // This margin can be tuned
         if (static_eval - rfp_margin >= beta) {
             rev_fut_count++;
@@ -128,7 +134,7 @@ SearchResult Engine::negamax(Board& board, int depth, int alpha, int beta, int p
 		if (static_eval != -MATE_SCORE) 
             current_eval = static_eval;
         else
-            current_eval = board.is_white_to_move() ? evaluate(board, EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE) : -evaluate(board, EVAL_MATERIAL | EVAL_POSITIONAL | EVAL_PAWN_STRUCTURE);
+            current_eval = board.is_white_to_move() ? evaluate<EvalCheap>(board) : -evaluate<EvalCheap>(board);
     }
     
 	// Late Move Reduction prerequisites here
@@ -144,24 +150,26 @@ SearchResult Engine::negamax(Board& board, int depth, int alpha, int beta, int p
     {   
 		pick_best(moves, scores, i);
 		const Move move = moves[i];
+        // Decide before making the move whether it checks, so pruning never touches checking moves
+        bool move_gives_check = board.gives_check(move);
         // Now do futility pruning. If positions evaluation is already way worse than alpha, cut it off since it is
         //unlikely to get that much better in just 1 or two moves
-        if(!first && should_futility_prune(depth,current_eval,alpha,king_is_in_check,move))
+        if(!first && should_futility_prune(depth,current_eval,alpha,king_is_in_check,move_gives_check,move))
         {
             continue;
 		}
         // Late Move Reduction
-		int reduction = late_move_reduction(depth, moves_searched, move, ply,tls);
+		int reduction = late_move_reduction(depth, moves_searched, move, move_gives_check, ply,tls);
         moves_searched++;
-        //Now make the move
-        board.make_move(move);
 
-		//If in check, we should increase depth by 1
+		//If move gives check, we should increase depth by 1
         int extension = 0;
-        if (board.in_check() && ply<64 && depth<=3)
+        if (move_gives_check && ply<64 && depth<=3)
         {
             extension=1;
 		}
+        //Now make the move
+        board.make_move(move);
         int evaluation;
         if (first) { 
 			SearchResult first_result = negamax(board, depth - 1 + extension, -beta, -alpha, ply + 1,tls);
@@ -226,7 +234,8 @@ int Engine::score_move(const Move& move, int ply,const Move& tt_move,bool depth_
 
     if (move == tt_move && !depth_0) { stage = TT_STAGE; sub = 0; }
     else if (move.promotion_piece != PieceType::NONE) {
-        stage = PROMO_STAGE; sub = PIECE_VALUES_MG[to_int(move.promotion_piece)] - PIECE_VALUES_MG[to_int(move.piece_captured)];
+        int captured_value = move.piece_captured == PieceType::NONE ? 0 : PIECE_VALUES_MG[to_int(move.piece_captured)];
+        stage = PROMO_STAGE; sub = PIECE_VALUES_MG[to_int(move.promotion_piece)] - captured_value;
     }
     else if (move.piece_captured != PieceType::NONE) {
         int see = see_move(board, move);
@@ -261,7 +270,7 @@ int Engine::quiescence_search(Board& board,int alpha, int beta,int ply, ThreadLo
 	bool in_check = board.in_check();
 
 
-    if (ply>=MAX_QUIET_PLY) return board.is_white_to_move() ? evaluate(board): -evaluate(board);
+    if (ply>=MAX_QUIET_PLY) return evaluate(board, alpha, beta);
 
     uint64_t hash=board.get_hash();
 
@@ -271,7 +280,7 @@ int Engine::quiescence_search(Board& board,int alpha, int beta,int ply, ThreadLo
     if (probe_tt(hash, 0 , alpha, beta, tt_score, tt_move,depth_0,TTMode::Quiescence)) {
         return tt_score;
     }
-	int stand_pat_score = board.is_white_to_move() ? evaluate(board) : -evaluate(board);
+	int stand_pat_score = evaluate(board, alpha, beta); // lazy: a stand pat far outside the window skips the piece terms
     if (stand_pat_score >= beta) {
         return stand_pat_score;
     } 
@@ -281,7 +290,9 @@ int Engine::quiescence_search(Board& board,int alpha, int beta,int ply, ThreadLo
     MoveList moves_to_search;
 	bool evade_check = board.in_check();
     if (evade_check)
-        MoveGenerator::generate_moves(board,moves_to_search); // evasions
+        MoveGenerator::generate_evasions(board,moves_to_search);
+    else if (ply == 0)
+        MoveGenerator::generate_captures_with_checks(board,moves_to_search); // captures plus quiet checks on the first ply
     else
         MoveGenerator::generate_captures(board,moves_to_search); // captures only
     int best_score=stand_pat_score;
@@ -295,7 +306,11 @@ int Engine::quiescence_search(Board& board,int alpha, int beta,int ply, ThreadLo
         pick_best(moves_to_search, scores, i);
         //if (scores[i] == NEG_SEE_SCORE) break;
         Move move = moves_to_search[i];
-        if (!evade_check) {
+        if (!evade_check && move.piece_captured == PieceType::NONE && move.promotion_piece == PieceType::NONE) {
+            // Quiet check: no material to delta-prune on, but drop it when the piece just hangs
+            if (see_move(board, move) < 0) continue;
+        }
+        else if (!evade_check) {
         int gain = 0;
         gain += PIECE_VALUES_QU[to_int(move.piece_captured)];
         if (move.promotion_piece != PieceType::NONE)
@@ -320,53 +335,107 @@ int Engine::quiescence_search(Board& board,int alpha, int beta,int ply, ThreadLo
     }
     return best_score;
 }
-uint64_t Engine::perft_driver(Board& board, int depth, int original_depth){
-    if (depth==0){
-        // if (board.in_check() && MoveGenerator::generate_moves(board).empty())
-        // {
-        //     checkmate_count+=1;
-        // }
-        
-        
-        return 1;
-        
-    }
+uint64_t Engine::perft_driver(Board& board, int depth, int ply, ThreadLocalData* tls){
+    if (depth==0) return 1;
+    if (depth==1) return static_cast<uint64_t>(MoveGenerator::count_legal_moves(board));
 
-    
-    
-    uint64_t nodes=0;
-	MoveList legal_moves;
+    uint64_t hash = board.get_hash();
+    uint64_t nodes = 0;
+    if (probe_perft(hash, depth, nodes)) return nodes;
+
+	MoveList& legal_moves = tls->move_lists[ply];
+    legal_moves.clear();
     MoveGenerator::generate_moves(board,legal_moves);
-    int new_nodes=0;
     for (const Move& move : legal_moves)
-    {   
-        
-        // if(move.is_en_passant) ep_count+=1;
-        // if(move.piece_captured!=PieceType::NONE) capture_count+=1;
+    {
         board.make_move(move);
-        // if (depth==1 and move.is_en_passant)
-        // {
-            
-        //     special_boards.push_back(board);
-        // }
-        
-        // if(board.in_check()){
-        //     checks_count+=1;
-        // }
-        
-		evaluate(board);
-     
-        new_nodes=perft_driver(board,depth-1,original_depth);
-        nodes+=new_nodes;
+        nodes+=perft_driver(board,depth-1,ply+1,tls);
         board.undo_move(move);
-        // if (depth==original_depth)
-        // {
-        //     std::cout << to_san(move,legal_moves) << "    " << new_nodes << std::endl;
-        // }
-        
+    }
+    store_perft(hash, depth, nodes);
+    return nodes;
+}
+bool Engine::probe_perft(uint64_t hash, int depth, uint64_t& out_nodes) {
+    hash ^= perft_generation * 0xC2B2AE3D27D4EB4FULL;
+    // Depth is folded into the index so the same position at different depths does not compete for one slot
+    PerftEntry& entry = perft_hash[(hash ^ (uint64_t(depth) * 0x9E3779B97F4A7C15ULL)) & (perft_hash.size() - 1)];
+    uint64_t data = std::atomic_ref<uint64_t>(entry.data).load(std::memory_order_relaxed);
+    uint64_t check = std::atomic_ref<uint64_t>(entry.check).load(std::memory_order_relaxed);
+    if ((check ^ data) != hash || int(data & 0xFF) != depth) return false;
+    out_nodes = data >> 8;
+    return true;
+}
+void Engine::store_perft(uint64_t hash, int depth, uint64_t nodes) {
+    hash ^= perft_generation * 0xC2B2AE3D27D4EB4FULL;
+    PerftEntry& entry = perft_hash[(hash ^ (uint64_t(depth) * 0x9E3779B97F4A7C15ULL)) & (perft_hash.size() - 1)];
+    uint64_t data = (nodes << 8) | uint64_t(depth & 0xFF);
+    std::atomic_ref<uint64_t>(entry.data).store(data, std::memory_order_relaxed);
+    std::atomic_ref<uint64_t>(entry.check).store(hash ^ data, std::memory_order_relaxed);
+}
+void Engine::run_perft_tasks(const Board& position, ThreadLocalData* tls) {
+    Board board = position;
+    while (true) {
+        size_t index = perft_next_task.fetch_add(1, std::memory_order_relaxed);
+        if (index >= perft_tasks.size()) return;
+        PerftTask& task = perft_tasks[index];
+        board.make_move(task.first);
+        if (task.has_second) board.make_move(task.second);
+        task.nodes = perft_driver(board, perft_task_depth, 0, tls);
+        if (task.has_second) board.undo_move(task.second);
+        board.undo_move(task.first);
+    }
+}
+PerftRes Engine::perft(const Board& position, int depth, std::vector<PerftDivide>* divide) {
+    auto start = std::chrono::steady_clock::now();
+    if (depth <= 0) return { 0.0, 1 };
+    if (perft_hash.empty()) perft_hash.resize(PERFT_HASH_MB * 1024ull * 1024ull / sizeof(PerftEntry));
+    perft_generation++;
+
+    Board board = position;
+    board.drop_accumulators();
+    MoveList root_moves;
+    MoveGenerator::generate_moves(board, root_moves);
+
+    // Deep trees are split at the reply level so a few heavy root moves cannot leave threads idle
+    bool split_replies = depth >= 4;
+    perft_tasks.clear();
+    for (int i = 0; i < (int)root_moves.size(); ++i) {
+        if (!split_replies) {
+            perft_tasks.push_back({ i, root_moves[i], Move(), false, 0 });
+            continue;
+        }
+        board.make_move(root_moves[i]);
+        MoveList replies;
+        MoveGenerator::generate_moves(board, replies);
+        for (const Move& reply : replies) perft_tasks.push_back({ i, root_moves[i], reply, true, 0 });
+        board.undo_move(root_moves[i]);
+    }
+    perft_task_depth = depth - (split_replies ? 2 : 1);
+    perft_next_task.store(0, std::memory_order_relaxed);
+
+    {
+        std::lock_guard<std::mutex> lk(pool_mtx);
+        job_type = JobType::Perft;
+        job_position = board;
+        active_workers = thread_count - 1;
+        job_id++;
+    }
+    if (thread_count > 1) cv_start.notify_all();
+    run_perft_tasks(board, &tls_data);
+    if (thread_count > 1) {
+        std::unique_lock<std::mutex> lk(pool_mtx);
+        cv_done.wait(lk, [&] {return active_workers == 0; });
     }
 
-    return nodes;  
+    std::vector<uint64_t> root_nodes(root_moves.size(), 0);
+    for (const PerftTask& task : perft_tasks) root_nodes[task.root_index] += task.nodes;
+    uint64_t total_nodes = 0;
+    for (int i = 0; i < (int)root_moves.size(); ++i) {
+        total_nodes += root_nodes[i];
+        if (divide) divide->push_back({ root_moves[i], root_nodes[i] });
+    }
+    std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+    return { duration.count(), total_nodes };
 }
 
 PerftRes Engine::perft_test(Board& board, int depth) {
@@ -376,8 +445,9 @@ PerftRes Engine::perft_test(Board& board, int depth) {
     uint64_t start_hash = board.get_hash();
     auto start_time = std::chrono::steady_clock::now();
 
-    // Call the recursive helper
-    uint64_t nodes_found = perft_driver(board, depth,depth);
+    // Split across the thread pool
+    PerftRes result = perft(board, depth);
+    uint64_t nodes_found = result.nodes;
 
     // Record the end time and calculate duration
     auto end_time = std::chrono::steady_clock::now();
@@ -566,19 +636,19 @@ bool Engine::store_tt(uint64_t hash, int depth, int original_alpha, int beta, in
    
 
 }
-bool Engine::should_futility_prune(int depth, int eval, int alpha, bool in_check,const Move& move) {
+bool Engine::should_futility_prune(int depth, int eval, int alpha, bool in_check, bool gives_check,const Move& move) {
 	if (depth > 2) return false;
     bool is_quiet = move.piece_captured == PieceType::NONE && move.promotion_piece == PieceType::NONE;
-    if (in_check || !is_quiet) return false;
+    if (in_check || gives_check || !is_quiet) return false;
     if (depth == 1 && eval + FUTILITY_MARGIN_D1 <= alpha) return true;
     if (depth == 2 && eval + FUTILITY_MARGIN_D2 <= alpha) return true;
     return false;
 }
-int Engine::late_move_reduction(int depth, int moves_searched, const Move& move, int ply,ThreadLocalData* tls) {
+int Engine::late_move_reduction(int depth, int moves_searched, const Move& move, bool gives_check, int ply,ThreadLocalData* tls) {
 	bool is_capture = (move.piece_captured != PieceType::NONE);
 	bool is_promotion = (move.promotion_piece != PieceType::NONE);
 	bool is_killer = (ply > 0 && (move == tls->killer_moves[ply][0] || move == tls->killer_moves[ply][1]));
-	bool is_special_move = is_capture || is_promotion || is_killer;
+	bool is_special_move = is_capture || is_promotion || is_killer || gives_check;
     if (!is_special_move && depth >= LMR_MIN_DEPTH && moves_searched > LMR_MIN_MOVES_SEARCHED) return LMR_REDUCTION_AMOUNT;
 	return 0;
 }
@@ -720,18 +790,28 @@ void Engine::worker_loop(int thread_id) {
     uint64_t seen_job = 0;
     Move local_best;
     int local_score = 0;
+    init_thread_eval_tables();
 
     while (true) {
         Board pos;
         SearchLimits limits;
+        JobType type;
         {
 			std::unique_lock<std::mutex> lk(pool_mtx);
 			cv_start.wait(lk, [&] {return terminate_pool || job_id != seen_job; });
 			if (terminate_pool) return;
 			seen_job = job_id;
+            type = job_type;
             pos = job_position;
             limits = job_limits;
         }
+        if (type == JobType::Perft) {
+            run_perft_tasks(pos, &tls_data);
+            std::lock_guard<std::mutex> lk(pool_mtx);
+            active_workers--;
+            if (active_workers == 0) cv_done.notify_one();
+            continue;
+        }
 
         Move tmp_best = local_best;
 		int tmp_score = local_score;    
@@ -849,6 +929,8 @@ void Engine::iterative_deepening_new(int thread_id, bool is_master, Move& io_bes
             std::cout.flush();
         }
     }
+    // Publish the tail of this thread's eval counts before the job is reported done
+    flush_eval_stats();
 }
 void Engine::perturb_root_order(MoveList& moves, int thread_id, int depth, uint64_t hash) {
     if (thread_id == 0) return;
@@ -931,6 +1013,8 @@ Move Engine::search(const Board& position, const SearchLimits& limits) {
     nodes.store(0, std::memory_order_relaxed);
     qnodes.store(0, std::memory_order_relaxed);
     tls_data.clear_counters();
+    reset_eval_stats();
+    init_thread_eval_tables();
 
     //reset timer +stop flag AFTER you publish job if you want workers to see consisten values
 	stop_search.store(false, std::memory_order_relaxed);
@@ -962,6 +1046,7 @@ Move Engine::search(const Board& position, const SearchLimits& limits) {
 		stop_search.store(false, std::memory_order_relaxed);
         start_time = std::chrono::steady_clock::now();
         time_limit = std::chrono::milliseconds(tc.time_ms);
+        job_type = JobType::Search;
 		job_position = position;
         job_limits = limits;
 		active_workers = std::max(0, use_threads - 1);
@@ -982,6 +1067,27 @@ Move Engine::search(const Board& position, const SearchLimits& limits) {
         cv_done.wait(lk, [&] {return active_workers == 0; });
 	}
 
+#ifdef ENGINE_STATS
+    // Diagnostics only: GUIs show every info string, so release builds stay quiet
+    EvalStats eval_stats = get_eval_stats();
+    if (eval_stats.lazy_calls > 0) {
+        std::cout << "info string lazy eval calls " << eval_stats.lazy_calls
+            << " early exits " << eval_stats.lazy_early_exits
+            << " (" << eval_stats.lazy_early_exits * 100 / eval_stats.lazy_calls << "%)\n";
+    }
+    if (eval_stats.cache_probes > 0) {
+        std::cout << "info string eval cache probes " << eval_stats.cache_probes
+            << " hits " << eval_stats.cache_hits
+            << " (" << eval_stats.cache_hits * 100 / eval_stats.cache_probes << "%)\n";
+    }
+    if (eval_stats.pawn_probes > 0) {
+        std::cout << "info string pawn hash probes " << eval_stats.pawn_probes
+            << " hits " << eval_stats.pawn_hits
+            << " (" << eval_stats.pawn_hits * 100 / eval_stats.pawn_probes << "%)\n";
+    }
+    std::cout.flush();
+#endif
+
     //std::cout << rev_fut_count;
 	return best_move_so_far;
 }
@@ -1014,6 +1120,13 @@ void Engine::resize_tt(size_t tt_size_mb) {
     start_thread_pool(saved_threads);
     stop_search.store(false, std::memory_order_relaxed);
 }
+void Engine::resize_pawn_hash(size_t pawn_hash_mb) {
+    // Workers allocate their pawn tables when they start, so restart them at the new size
+    set_pawn_hash_size(pawn_hash_mb);
+    int saved_threads = thread_count;
+    stop_thread_pool();
+    start_thread_pool(saved_threads);
+}
 std::string Engine::create_pv_string(const Board& board, const Move& best_move, int depth) {
     std::string pv = move_to_uci(best_move);
     Board b = board;
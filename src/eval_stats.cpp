@@ -0,0 +1,97 @@
+#include "eval_stats.h"
+
+#ifdef ENGINE_STATS
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eval_stats {
+namespace {
+    struct TermHistogram {
+        uint64_t buckets[BUCKET_COUNT] = {};
+        uint64_t count = 0;
+        int64_t sum = 0;
+        double sum_squares = 0.0;
+        int min = std::numeric_limits<int>::max();
+        int max = std::numeric_limits<int>::min();
+    };
+    struct ThreadHistograms {
+        TermHistogram terms[TERM_COUNT];
+    };
+
+    constexpr const char* TERM_NAMES[TERM_COUNT] = {
+        "material", "positional", "pawn_structure", "imbalance", "king_safety", "mobility",
+        "rook_activity", "bad_bishop", "fianchetto", "trapped_minors", "outpost", "total"
+    };
+
+    // The registry owns every thread's histograms so they outlive pool threads that exit;
+    // its mutex is taken once per thread, never while recording
+    std::mutex registry_mtx;
+    std::vector<std::unique_ptr<ThreadHistograms>> registry;
+    thread_local ThreadHistograms* local_histograms = nullptr;
+
+    ThreadHistograms& local() {
+        if (!local_histograms) {
+            std::lock_guard<std::mutex> lock(registry_mtx);
+            registry.push_back(std::make_unique<ThreadHistograms>());
+            local_histograms = registry.back().get();
+        }
+        return *local_histograms;
+    }
+}
+
+void record(Term term, int value) {
+    TermHistogram& histogram = local().terms[static_cast<int>(term)];
+    int bucket = (std::clamp(value, -HISTOGRAM_RANGE, HISTOGRAM_RANGE - 1) + HISTOGRAM_RANGE) / BUCKET_WIDTH;
+    histogram.buckets[bucket]++;
+    histogram.count++;
+    histogram.sum += value;
+    histogram.sum_squares += double(value) * value;
+    histogram.min = std::min(histogram.min, value);
+    histogram.max = std::max(histogram.max, value);
+}
+
+void dump(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(registry_mtx);
+    for (int term = 0; term < TERM_COUNT; ++term) {
+        TermHistogram merged;
+        for (const auto& thread : registry) {
+            const TermHistogram& h = thread->terms[term];
+            for (int b = 0; b < BUCKET_COUNT; ++b) merged.buckets[b] += h.buckets[b];
+            merged.count += h.count;
+            merged.sum += h.sum;
+            merged.sum_squares += h.sum_squares;
+            merged.min = std::min(merged.min, h.min);
+            merged.max = std::max(merged.max, h.max);
+        }
+        if (merged.count == 0) continue;
+
+        double mean = double(merged.sum) / merged.count;
+        double variance = std::max(0.0, merged.sum_squares / merged.count - mean * mean);
+        out << "info string evalstats term=" << TERM_NAMES[term]
+            << " count=" << merged.count
+            << " mean=" << mean
+            << " stddev=" << std::sqrt(variance)
+            << " min=" << merged.min
+            << " max=" << merged.max << "\n";
+        for (int b = 0; b < BUCKET_COUNT; ++b) {
+            if (merged.buckets[b] == 0) continue;
+            int low = b * BUCKET_WIDTH - HISTOGRAM_RANGE;
+            out << "info string evalstats term=" << TERM_NAMES[term]
+                << " bucket=" << low << ".." << low + BUCKET_WIDTH - 1
+                << " n=" << merged.buckets[b] << "\n";
+        }
+    }
+    out.flush();
+}
+
+void reset() {
+    std::lock_guard<std::mutex> lock(registry_mtx);
+    for (auto& thread : registry) *thread = ThreadHistograms{};
+}
+}
+#endif
@@ -1,7 +1,7 @@
-#include <iostream>
-#include <mutex>
 #include <memory>
 #include <array>
+#include <algorithm>
+#include <atomic>
 #include "evaluation.h"
 #include "constants.h"
 #include "pst.h"
@@ -11,60 +11,98 @@
 #include "attack_rays.h"
 #include "see.h"
 #include "adjustable_parameters.h"
-namespace {
-    struct KsStats {
-        int min = 1000000;
-        int max = -1000000;
-        long long sum = 0;
-        long long count = 0;
-    };
-
-    static KsStats g_ks_stats;
-    static std::mutex g_ks_mtx;
-
-    static thread_local KsStats tls_ks_stats;
-    static thread_local long long tls_samples = 0;
-
-    static void merge_ks_stats() {
-        std::lock_guard<std::mutex> lock(g_ks_mtx);
-        if (tls_ks_stats.min < g_ks_stats.min) g_ks_stats.min = tls_ks_stats.min;
-        if (tls_ks_stats.max > g_ks_stats.max) g_ks_stats.max = tls_ks_stats.max;
-        g_ks_stats.sum += tls_ks_stats.sum;
-        g_ks_stats.count += tls_ks_stats.count;
+#include "nnue.h"
+#include "eval_stats.h"
+// Evaluation counters: per thread, published in batches so the search threads never share a cache line
+enum EvalCounter { LAZY_CALLS, LAZY_EXITS, CACHE_PROBES, CACHE_HITS, PAWN_PROBES, PAWN_HITS, EVAL_COUNTER_COUNT };
+static std::atomic<uint64_t> eval_counters[EVAL_COUNTER_COUNT];
+static thread_local uint64_t tls_eval_counters[EVAL_COUNTER_COUNT];
+constexpr uint64_t EVAL_STATS_BATCH = 1024;
+
+static void flush_eval_counters() {
+    for (int i = 0; i < EVAL_COUNTER_COUNT; i++) {
+        eval_counters[i].fetch_add(tls_eval_counters[i], std::memory_order_relaxed);
+        tls_eval_counters[i] = 0;
+    }
+}
+static void record_lazy_eval(bool early_exit) {
+    tls_eval_counters[LAZY_CALLS]++;
+    if (early_exit) tls_eval_counters[LAZY_EXITS]++;
+}
+static void record_cache_probe(bool hit) {
+    if (hit) tls_eval_counters[CACHE_HITS]++;
+    if (++tls_eval_counters[CACHE_PROBES] == EVAL_STATS_BATCH) flush_eval_counters();
+}
+static void record_pawn_probe(bool hit) {
+    tls_eval_counters[PAWN_PROBES]++;
+    if (hit) tls_eval_counters[PAWN_HITS]++;
+}
 
-        tls_ks_stats = KsStats{};
+// Per-thread direct-mapped evaluation cache. Each slot packs the upper 48 bits of the key with
+// the 16-bit score; the low bits already selected the slot. The key mixes in the term mask, so
+// partial and full evaluations never alias, and the epoch, so invalidate_eval_caches() can retire
+// every thread's entries at once without touching their tables.
+static thread_local std::unique_ptr<std::array<uint64_t, EVAL_CACHE_SIZE>> eval_cache;
+static std::atomic<uint64_t> eval_cache_epoch{ 0 };
+constexpr uint64_t EVAL_CACHE_KEY_MASK = ~uint64_t(0xFFFF);
+
+static uint64_t eval_cache_key(const Board& board, uint8_t terms_mask) {
+    return board.get_hash()
+        ^ (uint64_t(terms_mask) * 0x9E3779B97F4A7C15ULL)
+        ^ (eval_cache_epoch.load(std::memory_order_relaxed) * 0xC2B2AE3D27D4EB4FULL);
+}
+static uint64_t& get_eval_cache_slot(uint64_t key) {
+    if (!eval_cache) {
+        eval_cache = std::make_unique<std::array<uint64_t, EVAL_CACHE_SIZE>>();
     }
+    return (*eval_cache)[key & (EVAL_CACHE_SIZE - 1)];
+}
+static bool probe_eval_cache(uint64_t key, int& score) {
+    uint64_t entry = get_eval_cache_slot(key);
+    bool hit = entry != 0 && (entry & EVAL_CACHE_KEY_MASK) == (key & EVAL_CACHE_KEY_MASK);
+    record_cache_probe(hit);
+    if (hit) score = static_cast<int16_t>(entry & 0xFFFF);
+    return hit;
+}
+static void store_eval_cache(uint64_t key, int score) {
+    get_eval_cache_slot(key) = (key & EVAL_CACHE_KEY_MASK) | uint16_t(static_cast<int16_t>(score));
+}
 
-    static void log_king_safety_sample(int value) {
-        if (value < tls_ks_stats.min) tls_ks_stats.min = value;
-        if (value > tls_ks_stats.max) tls_ks_stats.max = value;
-        tls_ks_stats.sum += value;
-        tls_ks_stats.count++;
-        tls_samples++;
+// Per-thread pawn hash; its entry count is fixed when the thread allocates it
+static std::atomic<size_t> pawn_hash_entries{ DEFAULT_PAWN_HASH_MB * 1024 * 1024 / sizeof(PawnEvalEntry) };
+static thread_local std::unique_ptr<PawnEvalEntry[]> pawn_evaluation_table;
+static thread_local size_t pawn_hash_mask = 0;
 
-        if ((tls_samples % 4096) == 0) {
-            merge_ks_stats();
-        }
-        if ((tls_samples % 65536) == 0) {
-            std::lock_guard<std::mutex> lock(g_ks_mtx);
-            double avg = g_ks_stats.count == 0 ? 0.0 : (double)g_ks_stats.sum / g_ks_stats.count;
-            std::cerr << "[KS] min=" << g_ks_stats.min
-                << " max=" << g_ks_stats.max
-                << " avg=" << avg
-                << " samples=" << g_ks_stats.count << "\n";
-        }
-    }
+void set_pawn_hash_size(size_t size_mb) {
+    size_t entries = 1;
+    while (entries * 2 * sizeof(PawnEvalEntry) <= size_mb * 1024 * 1024) entries *= 2;
+    pawn_hash_entries.store(entries, std::memory_order_relaxed);
+}
+static void init_pawn_table() {
+    size_t entries = pawn_hash_entries.load(std::memory_order_relaxed);
+    if (pawn_evaluation_table && pawn_hash_mask == entries - 1) return;
+    pawn_evaluation_table = std::make_unique<PawnEvalEntry[]>(entries);
+    pawn_hash_mask = entries - 1;
+}
+// Threads that never ran init_thread_eval_tables() (tools, perft checks) still allocate lazily
+static PawnEvalEntry& get_pawn_entry(uint64_t pawn_key) {
+    if (!pawn_evaluation_table) init_pawn_table();
+    return pawn_evaluation_table[pawn_key & pawn_hash_mask];
 }
 
-// Zei  le ~12: Ersetze die thread_local Array-Deklaration
-static thread_local std::unique_ptr<std::array<PawnEvalEntry, PAWN_HASH_SIZE>> pawn_evaluation_table;
+static thread_local std::unique_ptr<std::array<MaterialEntry, MATERIAL_HASH_SIZE>> material_table;
 
-// Helper-Funktion zum Lazy Init
-static PawnEvalEntry& get_pawn_entry(size_t idx) {
-    if (!pawn_evaluation_table) {
-        pawn_evaluation_table = std::make_unique<std::array<PawnEvalEntry, PAWN_HASH_SIZE>>();
+static MaterialEntry& get_material_slot(size_t idx) {
+    if (!material_table) {
+        material_table = std::make_unique<std::array<MaterialEntry, MATERIAL_HASH_SIZE>>();
     }
-    return (*pawn_evaluation_table)[idx];
+    return (*material_table)[idx];
+}
+
+void init_thread_eval_tables() {
+    init_pawn_table();
+    get_material_slot(0);
+    get_eval_cache_slot(0);
 }
 
 EvalContext::EvalContext(const Board& b)
@@ -104,6 +142,30 @@ EvalContext::EvalContext(const Board& b)
         }
     }
 }
+void EvalContext::compute_attack_maps() {
+    for (int color = 0; color < 2; color++) {
+        uint64_t pawns = pieces[color][to_int(PieceType::PAWN)];
+        uint64_t west = color == 0 ? (pawns & NOT_FILE_A) << 7 : (pawns & NOT_FILE_A) >> 9;
+        uint64_t east = color == 0 ? (pawns & NOT_FILE_H) << 9 : (pawns & NOT_FILE_H) >> 7;
+        attacked_by[color][to_int(PieceType::PAWN)] = west | east;
+        mobility_count[color][to_int(PieceType::PAWN)] = 0;
+
+        // Each piece is looked up exactly once; the mobility term reads the counts collected here
+        for (PieceType pt : {PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK, PieceType::QUEEN, PieceType::KING}) {
+            uint64_t by_type = 0;
+            int mobility = 0;
+            uint64_t bitboard = pieces[color][to_int(pt)];
+            while (bitboard) {
+                uint64_t attacks = pt == PieceType::KING ? KING_ATTACKS[get_lsb(bitboard)] : get_piece_attacks(pt, get_lsb(bitboard), all);
+                mobility += popcount(attacks & ~color_pieces[color]);
+                by_type |= attacks;
+                bitboard &= bitboard - 1;
+            }
+            attacked_by[color][to_int(pt)] = by_type;
+            mobility_count[color][to_int(pt)] = mobility;
+        }
+    }
+}
 
 
 
@@ -140,12 +202,10 @@ static EvaluationResult eval_iso_passed_pawns(EvalContext& ctx) {
                 ctx.passed_pawns[color] |= (1ULL << pawn_square);
                 if (color == 0) {
 
-                    score.mg_score += passed_pawns_MG[pawn_square];
-                    score.eg_score += passed_pawns_MG[pawn_square];
+                    score += EvaluationResult(passed_pawns_MG[pawn_square], passed_pawns_MG[pawn_square]);
                 }
                 else {
-                    score.mg_score -= passed_pawns_MG[flip_square(pawn_square)];
-                    score.eg_score -= passed_pawns_EG[flip_square(pawn_square)];
+                    score -= EvaluationResult(passed_pawns_MG[flip_square(pawn_square)], passed_pawns_EG[flip_square(pawn_square)]);
 
                 }
                 pawns &= pawns - 1;
@@ -164,10 +224,8 @@ static EvaluationResult eval_iso_passed_pawns(EvalContext& ctx) {
             pawns &= pawns - 1;
         }
     }
-    score.mg_score += iso_count * ISOLATED_PAWN_PENALTY_MG;
-    score.eg_score += iso_count * ISOLATED_PAWN_PENALTY_EG;
-    score.mg_score += blocked_iso_count * BLOCKED_ISO_PENALTY_MG;
-    score.eg_score += blocked_iso_count * BLOCKED_ISO_PENALTY_EG;
+    score += iso_count * EvaluationResult(ISOLATED_PAWN_PENALTY_MG, ISOLATED_PAWN_PENALTY_EG);
+    score += blocked_iso_count * EvaluationResult(BLOCKED_ISO_PENALTY_MG, BLOCKED_ISO_PENALTY_EG);
     return score;
 }
 static EvaluationResult eval_pawn_islands(const EvalContext& ctx) {
@@ -201,8 +259,7 @@ static EvaluationResult eval_pawn_islands(const EvalContext& ctx) {
             }
         }
     }
-    score.mg_score += pawn_island_count * PAWN_ISLAND_PENALTY_MG;
-    score.eg_score += pawn_island_count * PAWN_ISLAND_PENALTY_EG;
+    score += pawn_island_count * EvaluationResult(PAWN_ISLAND_PENALTY_MG, PAWN_ISLAND_PENALTY_EG);
     return score;
 }
 static EvaluationResult eval_candidate_passed_pawn(const EvalContext& ctx) {
@@ -283,8 +340,7 @@ static EvaluationResult eval_pawn_majorities(const EvalContext& ctx) {
             island_active = true;
         }
     }
-    score.mg_score += number_of_majorities * PAWN_MAJORITY_BONUS_MG;
-    score.eg_score += number_of_majorities * PAWN_MAJORITY_BONUS_EG;
+    score += number_of_majorities * EvaluationResult(PAWN_MAJORITY_BONUS_MG, PAWN_MAJORITY_BONUS_EG);
     return score;
 }
 static EvaluationResult eval_double_pawns(const EvalContext& ctx) {
@@ -306,8 +362,7 @@ static EvaluationResult eval_double_pawns(const EvalContext& ctx) {
             doubled_count[file] -= black_doubled - 1;
         }
 
-        score.mg_score += doubled_count[file] * DOUBLED_PAWN_PENALTY_MG[file];
-        score.eg_score += doubled_count[file] * DOUBLED_PAWN_PENALTY_EG[file];
+        score += doubled_count[file] * EvaluationResult(DOUBLED_PAWN_PENALTY_MG[file], DOUBLED_PAWN_PENALTY_EG[file]);
     }
     return score;
 }
@@ -355,257 +410,19 @@ static EvaluationResult eval_king_safety_score(const EvalContext& ctx) {
         }
     }
     //TODO: Scale safety score with enemy material.
-    score.mg_score += pawn_shield_count * PAWN_SHIELD_BONUS_MG;
-    score.eg_score += pawn_shield_count * PAWN_SHIELD_BONUS_EG;
+    score += pawn_shield_count * EvaluationResult(PAWN_SHIELD_BONUS_MG, PAWN_SHIELD_BONUS_EG);
 
-    score.mg_score += next_to_open_count * NEXT_TO_OPEN_FILE_PENALTY_MG;
-    score.eg_score += next_to_open_count * NEXT_TO_OPEN_FILE_PENALTY_EG;
+    score += next_to_open_count * EvaluationResult(NEXT_TO_OPEN_FILE_PENALTY_MG, NEXT_TO_OPEN_FILE_PENALTY_EG);
 
-    score.mg_score += next_to_semi_open_count * NEXT_TO_SEMI_OPEN_FILE_PENALTY_MG;
-    score.eg_score += next_to_semi_open_count * NEXT_TO_SEMI_OPEN_FILE_PENALTY_EG;
+    score += next_to_semi_open_count * EvaluationResult(NEXT_TO_SEMI_OPEN_FILE_PENALTY_MG, NEXT_TO_SEMI_OPEN_FILE_PENALTY_EG);
     for (size_t count = 0; count < 7; count++) {
 
-        score.mg_score += next_to_open_diagonal_count[count] * NEXT_TO_OPEN_DIAGONAL_PENALTY_MG[count];
-        score.eg_score += next_to_open_diagonal_count[count] * NEXT_TO_OPEN_DIAGONAL_PENALTY_EG[count];
+        score += next_to_open_diagonal_count[count] * EvaluationResult(NEXT_TO_OPEN_DIAGONAL_PENALTY_MG[count], NEXT_TO_OPEN_DIAGONAL_PENALTY_EG[count]);
 
     }
     return score;
 
 }
-static EvaluationResult eval_attack_score(const EvalContext& ctx) {
-    EvaluationResult score = { 0,0 };
-    int pawn_attacks_in_king_zone_count = 0;
-    int pawn_attacks_in_small_king_zone_count = 0;
-    int king_tropism_queen_distance_count[8] = { 0, 0,0,0,0,0,0,0 };
-    int king_tropism_other_distance_count[8] = { 0, 0,0,0,0,0,0,0 };
-    int king_attackers_count[8] = { 0,0,0,0,0,0,0 };
-    int rooks_on_open_file_next_to_king_count = 0;
-    int queens_on_open_file_next_to_king_count = 0;
-    int rooks_on_semi_open_file_next_to_king_count = 0;
-    int queens_on_semi_open_file_next_to_king_count = 0;
-    int weak_piece_attack_count[8] = { 0,0,0,0,0,0,0,0 };
-    for (size_t color = 0; color < 2; color++) {
-        int ecolor = color == 0 ? 1 : 0;
-
-        int op_king_file_index = ctx.king_sq[ecolor] % 8;
-        uint64_t op_king_zone = KING_ZONE[ctx.king_sq[ecolor]];
-        uint64_t op_small_king_zone = SMALL_KING_ZONE[ctx.king_sq[ecolor]];
-
-        //1. Pawn Attacks in King Zone (cheap to compute)
-        uint64_t pawn_attacks = get_pawn_attacks(ctx.pieces[color][to_int(PieceType::PAWN)], static_cast<Color>(color));
-        pawn_attacks_in_king_zone_count += color == 0 ? popcount(pawn_attacks & op_king_zone) : -popcount(pawn_attacks & op_king_zone);
-        pawn_attacks_in_small_king_zone_count += color == 0 ? popcount(pawn_attacks & op_small_king_zone) : -popcount(pawn_attacks & op_small_king_zone);
-
-        //2. King Tropism (distance-based)
-        auto king_tropism = [&](uint64_t attackers, PieceType pt) {
-            while (attackers) {
-                int sq = get_lsb(attackers);
-                if (pt == PieceType::QUEEN) {
-
-                    king_tropism_queen_distance_count[king_distance(sq, ctx.king_sq[ecolor])] += color == 0 ? 1 : -1;
-                }
-                else {
-                    king_tropism_other_distance_count[king_distance(sq, ctx.king_sq[ecolor])] += color == 0 ? 1 : -1;
-                }
-                attackers &= attackers - 1;
-            }
-            };
-
-        king_tropism(ctx.pieces[color][to_int(PieceType::ROOK)], PieceType::ROOK);
-        king_tropism(ctx.pieces[color][to_int(PieceType::BISHOP)], PieceType::BISHOP);
-        king_tropism(ctx.pieces[color][to_int(PieceType::QUEEN)], PieceType::QUEEN);
-        king_tropism(ctx.pieces[color][to_int(PieceType::KNIGHT)], PieceType::KNIGHT);
-
-        //3. King Attackers (detailed attack evaluation)
-        int attackers_count = 0;
-        int value_count = 0;
-        auto king_attackers = [&](uint64_t attackers, PieceType pt, uint64_t& all) {
-            if (pt == PieceType::KNIGHT) {
-                while (attackers) {
-                    int sq = get_lsb(attackers);
-                    int number_of_squares_attacked = popcount(KNIGHT_ATTACKS[sq] & op_small_king_zone);
-                    if (number_of_squares_attacked > 0) {
-                        attackers_count += 1;
-                    }
-                    value_count += 20 * number_of_squares_attacked;
-                    attackers &= attackers - 1;
-                    
-                }
-            }
-            else if (pt == PieceType::BISHOP) {
-                while (attackers) {
-                    int sq = get_lsb(attackers);
-                    int number_of_squares_attacked = popcount(get_bishop_attacks(sq, all) & op_small_king_zone);
-                    if (number_of_squares_attacked > 0) {
-                        attackers_count += 1;
-                        all &= ~(1ULL << sq);
-                    }
-                    value_count += 20 * number_of_squares_attacked;
-                    attackers &= attackers - 1;
-                }
-            }
-            else if (pt == PieceType::ROOK) {
-                while (attackers) {
-                    int sq = get_lsb(attackers);
-                    int number_of_squares_attacked = popcount(get_rook_attacks(sq, all) & op_small_king_zone);
-                    if (number_of_squares_attacked > 0) {
-                        attackers_count += 1;
-                        all &= ~(1ULL << sq);
-                    }
-                    value_count += 40 * number_of_squares_attacked;
-                    attackers &= attackers - 1;
-                }
-
-            }
-            else if (pt == PieceType::QUEEN) {
-                while (attackers) {
-                    int sq = get_lsb(attackers);
-                    int number_of_squares_attacked = popcount(get_queen_attacks(sq, all) & op_small_king_zone);
-                    if (number_of_squares_attacked > 0) {
-                        attackers_count += 1;
-                        all &= ~(1ULL << sq);
-                    }
-                    value_count += 80 * number_of_squares_attacked;
-                    attackers &= attackers - 1;
-
-                }
-            }
-            };
-        uint64_t occ = ctx.all;
-
-        king_attackers(ctx.pieces[color][to_int(PieceType::KNIGHT)], PieceType::KNIGHT, occ);//Order important for occ update
-        king_attackers(ctx.pieces[color][to_int(PieceType::BISHOP)], PieceType::BISHOP, occ);
-        king_attackers(ctx.pieces[color][to_int(PieceType::ROOK)], PieceType::ROOK, occ);
-        king_attackers(ctx.pieces[color][to_int(PieceType::QUEEN)], PieceType::QUEEN, occ);
-        //scale by attacker count (non-linear bonus)
-        if (attackers_count > 7) attackers_count = 7;
-        king_attackers_count[attackers_count] += color == 0 ? value_count : -value_count;
-        //score[color] += value_count * KING_ATTACKER_VALUE_SCALE[attackers_count];
-
-        //5. Bonus if attacker has rooks/queens on open/semi-open files near king
-
-        int r = popcount((ctx.pieces[color][to_int(PieceType::ROOK)]) & THREE_SURR_FILE_MASK[op_king_file_index] & ctx.open_files);
-        rooks_on_open_file_next_to_king_count += color == 0 ? r : -r;
-        int q = popcount((ctx.pieces[color][to_int(PieceType::QUEEN)]) & THREE_SURR_FILE_MASK[op_king_file_index] & ctx.open_files);
-        queens_on_open_file_next_to_king_count += color == 0 ? q : -q;
-
-        r = popcount((ctx.pieces[color][to_int(PieceType::ROOK)]) & THREE_SURR_FILE_MASK[op_king_file_index] & ctx.no_color_pawn_files[ecolor] & ~ctx.open_files);
-        rooks_on_semi_open_file_next_to_king_count += color == 0 ? r : -r;
-        q = popcount((ctx.pieces[color][to_int(PieceType::QUEEN)]) & THREE_SURR_FILE_MASK[op_king_file_index] & ctx.no_color_pawn_files[ecolor] & ctx.open_files);
-        queens_on_semi_open_file_next_to_king_count += color == 0 ? q : -q;
-
-        // --- A. Identify weak/undefended pieces ---
-        uint64_t defended_by_op_pawns = get_pawn_attacks(ctx.pieces[ecolor][to_int(PieceType::PAWN)], static_cast<Color>(ecolor));
-
-        //1. Undefended pieces (not protected by pawns)
-        uint64_t weak_pieces = 0;
-        weak_pieces |= ctx.pieces[ecolor][to_int(PieceType::KNIGHT)];
-        weak_pieces |= ctx.pieces[ecolor][to_int(PieceType::BISHOP)];
-        weak_pieces |= ctx.pieces[ecolor][to_int(PieceType::ROOK)];
-        weak_pieces |= ctx.pieces[ecolor][to_int(PieceType::QUEEN)];
-        weak_pieces &= ~defended_by_op_pawns;
-        weak_pieces |= ctx.backward_pawns[ecolor];
-        weak_pieces |= ctx.isolated_pawns[ecolor];
-        weak_pieces |= ctx.passed_pawns[ecolor];
-        // --- B. Calculate attacks on weak pieces ---
-        while (weak_pieces) {
-
-            int value_count = 0;
-            int attack_count = 0;
-            uint64_t occ = ctx.all;
-            int sq = get_lsb(weak_pieces);
-            int new_attackers = popcount(ctx.pieces[color][to_int(PieceType::KNIGHT)] & KNIGHT_ATTACKS[sq]);
-            value_count += KNIGHT_ATTACK_VALUE * new_attackers;
-            attack_count += new_attackers;
-
-            uint64_t bishop_attackers = ctx.pieces[color][to_int(PieceType::BISHOP)] & get_bishop_attacks(sq, occ);
-            new_attackers = popcount(bishop_attackers);
-            value_count += BISHOP_ATTACK_VALUE * new_attackers;
-            attack_count += new_attackers;
-            occ &= ~bishop_attackers;
-
-            uint64_t rook_attackers = ctx.pieces[color][to_int(PieceType::ROOK)] & get_rook_attacks(sq, occ);
-            new_attackers = popcount(rook_attackers);
-            value_count += ROOK_ATTACK_VALUE * new_attackers;
-            attack_count += new_attackers;
-            occ &= ~rook_attackers;
-
-            new_attackers = popcount(ctx.pieces[color][to_int(PieceType::QUEEN)] & get_queen_attacks(sq, occ));
-            value_count += QUEEN_ATTACK_VALUE * new_attackers;
-            attack_count += new_attackers;
-
-            if (attack_count > 7) attack_count = 7;
-            weak_piece_attack_count[attack_count] += color == 0 ? value_count : -value_count;
-            weak_pieces &= weak_pieces - 1;
-        }
-
-
-
-
-
-    }
-    score.mg_score += pawn_attacks_in_king_zone_count * PAWN_ATTACKS_IN_KING_ZONE_BONUS_MG;
-    score.eg_score += pawn_attacks_in_king_zone_count * PAWN_ATTACKS_IN_KING_ZONE_BONUS_EG;
-
-    score.mg_score += pawn_attacks_in_small_king_zone_count * PAWN_ATTACKS_IN_SMALL_KING_ZONE_BONUS_MG;
-    score.eg_score += pawn_attacks_in_small_king_zone_count * PAWN_ATTACKS_IN_SMALL_KING_ZONE_BONUS_EG;
-    for (int i = 0; i < 8; i++) {
-        score.mg_score += king_tropism_queen_distance_count[i] * KING_TROPISM_QUEEN_BONUS_MG[i];
-        score.eg_score += king_tropism_queen_distance_count[i] * KING_TROPISM_QUEEN_BONUS_EG[i];
-        score.mg_score += king_tropism_other_distance_count[i] * KING_TROPISM_OTHER_BONUS_MG[i];
-        score.eg_score += king_tropism_other_distance_count[i] * KING_TROPISM_OTHER_BONUS_EG[i];
-    }
-    for (int i = 0; i < 8; i++) {
-        score.mg_score += king_attackers_count[i] * KING_ATTACKER_VALUE_SCALE_MG[i];
-        score.eg_score += king_attackers_count[i] * KING_ATTACKER_VALUE_SCALE_EG[i];
-        score.mg_score += weak_piece_attack_count[i] * WEAK_PIECE_ATTACK_BONUS_MG[i];
-        score.eg_score += weak_piece_attack_count[i] * WEAK_PIECE_ATTACK_BONUS_EG[i];
-    }
-    score.mg_score += rooks_on_open_file_next_to_king_count * ROOK_ON_OPEN_FILE_NEXT_TO_KING_BONUS_MG;
-    score.eg_score += rooks_on_open_file_next_to_king_count * ROOK_ON_OPEN_FILE_NEXT_TO_KING_BONUS_EG;
-    score.mg_score += queens_on_open_file_next_to_king_count * QUEEN_ON_OPEN_FILE_NEXT_TO_KING_BONUS_MG;
-    score.eg_score += queens_on_open_file_next_to_king_count * QUEEN_ON_OPEN_FILE_NEXT_TO_KING_BONUS_EG;
-    score.mg_score += rooks_on_semi_open_file_next_to_king_count * ROOK_ON_SEMI_OPEN_FILE_NEXT_TO_KING_BONUS_MG;
-    score.eg_score += rooks_on_semi_open_file_next_to_king_count * ROOK_ON_SEMI_OPEN_FILE_NEXT_TO_KING_BONUS_EG;
-    score.mg_score += queens_on_semi_open_file_next_to_king_count * QUEEN_ON_SEMI_OPEN_FILE_NEXT_TO_KING_BONUS_MG;
-    score.eg_score += queens_on_semi_open_file_next_to_king_count * QUEEN_ON_SEMI_OPEN_FILE_NEXT_TO_KING_BONUS_EG;
-
-    return score;
-}
-// dont use this? 
-static  EvaluationResult eval_defence_score(const EvalContext& ctx) {
-	EvaluationResult score = { 0,0 };
-	uint64_t all_attacks[2] = { 0,0 };
-	int undefended_pieces_count[5] = { 0,0,0,0,0 };
-	int hanging_oieces_count[5] = { 0,0,0,0,0 };    
-    for (size_t color = 0; color < 2; color++) {
-		int ecolor = color == 0 ? 1 : 0;
-		all_attacks[color] |= get_pawn_attacks(ctx.pieces[color][to_int(PieceType::PAWN)], static_cast<Color>(color));
-        all_attacks[color] |= ctx.board.get_knight_attacks_for_color(static_cast<Color>(color));
-        all_attacks[color] |= ctx.board.get_bishop_attacks_for_color(static_cast<Color>(color));
-        all_attacks[color] |= ctx.board.get_rook_attacks_for_color(static_cast<Color>(color));
-        all_attacks[color] |= ctx.board.get_queen_attacks_for_color(static_cast<Color>(color));
-        all_attacks[color] |= ctx.board.get_king_attacks_for_color(static_cast<Color>(color));
-    }
-    for (size_t color = 0; color < 2; color++) {
-        int ecolor = color == 0 ? 1 : 0;
-        uint64_t undefended_pieces = ctx.color_pieces[color] & ~all_attacks[color];
-        uint64_t hanging_pieces = undefended_pieces & all_attacks[ecolor];
-        for (PieceType pt : {PieceType::PAWN, PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK, PieceType::QUEEN }) {
-            int undefended_count = popcount(undefended_pieces & ctx.pieces[color][to_int(pt)]&~hanging_pieces);
-            int hanging_count = popcount(hanging_pieces & ctx.pieces[color][to_int(pt)]);
-            undefended_pieces_count[to_int(pt)] += color == 0 ? undefended_count : -undefended_count;
-            hanging_oieces_count[to_int(pt)] += color == 0 ? hanging_count : -hanging_count;
-        }
-    }
-    for (int i = 0; i < 5; i++) {
-        score.mg_score += undefended_pieces_count[i] * UNDEFENDED_PIECE_PENALTY_MG[i];
-        score.eg_score += undefended_pieces_count[i] * UNDEFENDED_PIECE_PENALTY_EG[i];
-        score.mg_score += hanging_oieces_count[i] * HANGING_PIECE_PENALTY_MG[i];
-        score.eg_score += hanging_oieces_count[i] * HANGING_PIECE_PENALTY_EG[i];
-	}
-	return score;
-}
 static EvaluationResult eval_backward_pawns(EvalContext& ctx) {
     EvaluationResult score = { 0,0 };
     int blocked_backward_count = 0;
@@ -647,13 +464,9 @@ static EvaluationResult eval_backward_pawns(EvalContext& ctx) {
         }
 
     }
-    score.mg_score += blocked_backward_count * FORWARD_BLOCKED_BACKWARD_MG
-        + forwad_controlled_backward_count * FORWARD_CONTROLLED_BACKWARD_PENALTY_MG
-        + free_to_advance_backward_count * FREE_TO_ADVANCE_BACKWARD_MG;
-
-    score.eg_score += blocked_backward_count * FORWARD_BLOCKED_BACKWARD_EG
-        + forwad_controlled_backward_count * FORWARD_CONTROLLED_BACKWARD_PENALTY_EG
-        + free_to_advance_backward_count * FREE_TO_ADVANCE_BACKWARD_EG;
+    score += blocked_backward_count * EvaluationResult(FORWARD_BLOCKED_BACKWARD_MG, FORWARD_BLOCKED_BACKWARD_EG)
+        + forwad_controlled_backward_count * EvaluationResult(FORWARD_CONTROLLED_BACKWARD_PENALTY_MG, FORWARD_CONTROLLED_BACKWARD_PENALTY_EG)
+        + free_to_advance_backward_count * EvaluationResult(FREE_TO_ADVANCE_BACKWARD_MG, FREE_TO_ADVANCE_BACKWARD_EG);
     return score;
 }
 static EvaluationResult evaluate_rook_activity(const EvalContext& ctx) {
@@ -678,48 +491,58 @@ static EvaluationResult evaluate_rook_activity(const EvalContext& ctx) {
                 rook_behind_free_pawn -= popcount(ctx.pieces[1][to_int(PieceType::ROOK)] & FORWARD_WAY_MASK[0][black_passed]);
             }
         }
-        int white_rook_square = get_lsb(ctx.pieces[0][to_int(PieceType::ROOK)]);
-        int black_rook_square = get_lsb(ctx.pieces[1][to_int(PieceType::ROOK)]);
-        int white_connected = get_rook_attacks(white_rook_square, ctx.all) & ctx.pieces[0][to_int(PieceType::ROOK)];
-        int black_connected = get_rook_attacks(black_rook_square, ctx.all) & ctx.pieces[1][to_int(PieceType::ROOK)];
-        connected_rooks += popcount(white_connected) - popcount(black_connected);
-        score.mg_score = open_count*ROOK_OPEN_FILE_BONUS_MG;
-		score.eg_score = open_count * ROOK_OPEN_FILE_BONUS_EG;
-		score.mg_score += semi_open_count * ROOK_SEMI_OPEN_FILE_BONUS_MG;
-		score.eg_score += semi_open_count * ROOK_SEMI_OPEN_FILE_BONUS_EG;
-		score.mg_score += rook_behind_free_pawn * ROOK_BEHIND_FREE_PAWN_BONUS_MG;
-		score.eg_score += rook_behind_free_pawn * ROOK_BEHIND_FREE_PAWN_BONUS_EG;
-		score.mg_score += connected_rooks * CONNECTED_ROOKS_BONUS_MG;
-		score.eg_score += connected_rooks * CONNECTED_ROOKS_BONUS_EG;
+        // Rook attacks are symmetric, so a rook seen by another rook means the pair is connected
+        bool white_connected = (ctx.attacked_by[0][to_int(PieceType::ROOK)] & ctx.pieces[0][to_int(PieceType::ROOK)]) != 0;
+        bool black_connected = (ctx.attacked_by[1][to_int(PieceType::ROOK)] & ctx.pieces[1][to_int(PieceType::ROOK)]) != 0;
+        connected_rooks += int(white_connected) - int(black_connected);
+        score = open_count * EvaluationResult(ROOK_OPEN_FILE_BONUS_MG, ROOK_OPEN_FILE_BONUS_EG);
+		score += semi_open_count * EvaluationResult(ROOK_SEMI_OPEN_FILE_BONUS_MG, ROOK_SEMI_OPEN_FILE_BONUS_EG);
+		score += rook_behind_free_pawn * EvaluationResult(ROOK_BEHIND_FREE_PAWN_BONUS_MG, ROOK_BEHIND_FREE_PAWN_BONUS_EG);
+		score += connected_rooks * EvaluationResult(CONNECTED_ROOKS_BONUS_MG, CONNECTED_ROOKS_BONUS_EG);
         return score;
 }
-static EvaluationResult evaluate_bishop_pair(const EvalContext& ctx) {
+static EvaluationResult evaluate_bishop_pair(const int (&counts)[2][6]) {
     EvaluationResult score = { 0,0 };
     int count = 0;
-    count += popcount(ctx.pieces[0][to_int(PieceType::BISHOP)]) >= 2 ? 1 : 0;
-    count -= popcount(ctx.pieces[1][to_int(PieceType::BISHOP)]) >= 2 ? 1 : 0;
-    score.mg_score += count * BISHOP_PAIR_BONUS_MG;
-    score.eg_score += count * BISHOP_PAIR_BONUS_EG;
+    count += counts[0][to_int(PieceType::BISHOP)] >= 2 ? 1 : 0;
+    count -= counts[1][to_int(PieceType::BISHOP)] >= 2 ? 1 : 0;
+    score += count * EvaluationResult(BISHOP_PAIR_BONUS_MG, BISHOP_PAIR_BONUS_EG);
     return score;
 }
+static MaterialEntry compute_material_entry(const Board& board) {
+    MaterialEntry entry{};
+    entry.key = board.get_material_key();
+    entry.valid = true;
+
+    int counts[2][6];
+    for (int color = 0; color < 2; ++color) {
+        for (int piece = 0; piece < 6; ++piece) {
+            counts[color][piece] = popcount(board.get_pieces(static_cast<Color>(color), static_cast<PieceType>(piece)));
+        }
+    }
+    entry.imbalance = evaluate_bishop_pair(counts);
+    entry.game_phase = static_cast<uint8_t>(std::min(board.get_game_phase(), 24));
+
+    endgame::Functions endgame_functions = endgame::lookup(board);
+    entry.endgame_eval = endgame_functions.value;
+    entry.endgame_scale[0] = endgame_functions.scale[0];
+    entry.endgame_scale[1] = endgame_functions.scale[1];
+    return entry;
+}
+static const MaterialEntry& probe_material(const Board& board) {
+    uint64_t material_key = board.get_material_key();
+    MaterialEntry& entry = get_material_slot(material_key & (MATERIAL_HASH_SIZE - 1));
+    if (!(entry.valid && entry.key == material_key)) {
+        entry = compute_material_entry(board);
+    }
+    return entry;
+}
 static EvaluationResult evaluate_mobility(const EvalContext& ctx) {
     EvaluationResult mobility = { 0,0 };
     for (PieceType pt : {PieceType::KNIGHT, PieceType::BISHOP, PieceType::ROOK, PieceType::QUEEN}) {
-        int mob_count = 0;
-        for (int color = 0; color < 2; color++) {
-            uint64_t pieces = ctx.pieces[color][to_int(pt)];
-            while (pieces) {
-                int sq = get_lsb(pieces);
-                if (color == 0)
-                    mob_count += popcount(get_piece_attacks(pt, sq, ctx.all) & ~ctx.color_pieces[color]);
-                else
-                    mob_count -= popcount(get_piece_attacks(pt, sq, ctx.all) & ~ctx.color_pieces[color]);
-                pieces &= pieces - 1;
-            }
-        }
+        int mob_count = ctx.mobility_count[0][to_int(pt)] - ctx.mobility_count[1][to_int(pt)];
 
-        mobility.mg_score += mob_count * MOBILITY_BONUS_MG[to_int(pt)];
-        mobility.eg_score += mob_count * MOBILITY_BONUS_EG[to_int(pt)];
+        mobility += mob_count * EvaluationResult(MOBILITY_BONUS_MG[to_int(pt)], MOBILITY_BONUS_EG[to_int(pt)]);
     }
     return mobility;
 }
@@ -758,10 +581,8 @@ static EvaluationResult evaluate_bad_bishop(const EvalContext& ctx) {
         }
     }
 
-    score.mg_score += blocked_penalty_count * BAD_BISHOP_BLCOKED_MG;
-    score.eg_score += blocked_penalty_count * BAD_BISHOP_BLOCKED_EG;
-    score.mg_score += unblocked_penalty_count * BAD_BISHOP_UNBLOCKED_MG;
-    score.eg_score += unblocked_penalty_count * BAD_BISHOP_UNBLOCKED_EG;
+    score += blocked_penalty_count * EvaluationResult(BAD_BISHOP_BLCOKED_MG, BAD_BISHOP_BLOCKED_EG);
+    score += unblocked_penalty_count * EvaluationResult(BAD_BISHOP_UNBLOCKED_MG, BAD_BISHOP_UNBLOCKED_EG);
 
     return score;
 }
@@ -796,10 +617,8 @@ static EvaluationResult evaluate_fianchetto_bishop(const EvalContext& ctx) {
             bishops_fianchetto &= bishops_fianchetto - 1;
         }
     }
-    score.mg_score += intact_count * FIANCHETTO_BISHOP_BONUS_MG;
-    score.eg_score += intact_count * FIANCHETTO_BISHOP_BONUS_EG;
-    score.mg_score += broken_count * BROKEN_FIANCHETTO_PENALTY_MG;
-    score.eg_score += broken_count * BROKEN_FIANCHETTO_PENALTY_EG;
+    score += intact_count * EvaluationResult(FIANCHETTO_BISHOP_BONUS_MG, FIANCHETTO_BISHOP_BONUS_EG);
+    score += broken_count * EvaluationResult(BROKEN_FIANCHETTO_PENALTY_MG, BROKEN_FIANCHETTO_PENALTY_EG);
 
     return score;
 }
@@ -879,10 +698,8 @@ static EvaluationResult evaluate_trapped_minor_pieces(const EvalContext& ctx) {
             knights &= knights - 1;
         }
     }
-    score.mg_score += trapped_bishop_count * TRAPPED_BISHOP_PENALTY_MG;
-    score.eg_score += trapped_bishop_count * TRAPPED_BISHOP_PENALTY_EG;
-    score.mg_score += trapped_knight_count * TRAPPED_KNIGHT_PENALTY_MG;
-    score.eg_score += trapped_knight_count * TRAPPED_KNIGHT_PENALTY_EG;
+    score += trapped_bishop_count * EvaluationResult(TRAPPED_BISHOP_PENALTY_MG, TRAPPED_BISHOP_PENALTY_EG);
+    score += trapped_knight_count * EvaluationResult(TRAPPED_KNIGHT_PENALTY_MG, TRAPPED_KNIGHT_PENALTY_EG);
 
     return score;
 }
@@ -894,7 +711,7 @@ static EvaluationResult evaluate_outpost(const EvalContext& ctx) {
     int knight_outpost_count_with_op_bishop = 0;
     for (int color = 0; color < 2; color++) {
         int ecolor = color == 0 ? 1 : 0;
-        uint64_t defended_by_own_pawn = get_pawn_attacks(ctx.pieces[color][to_int(PieceType::PAWN)], static_cast<Color>(color));
+        uint64_t defended_by_own_pawn = ctx.attacked_by[color][to_int(PieceType::PAWN)];
         uint64_t out_post_mask = color == 0 ? WHITE_OUTPOST_MASK : BLACK_OUTPOST_MASK;
         uint64_t possible_bishop_outposts[2];
         uint64_t possible_knight_outposts[2];
@@ -924,23 +741,20 @@ static EvaluationResult evaluate_outpost(const EvalContext& ctx) {
         count_outposts(possible_knight_outposts[1], dark_square_bishop_exists, knight_outpost_count_no_op_bishop, knight_outpost_count_with_op_bishop);
 
     }
-    score.mg_score += bishop_outpost_count_no_op_bishop * BISHOP_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_MG;
-    score.eg_score += bishop_outpost_count_no_op_bishop * BISHOP_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_EG;
-    score.mg_score += bishop_outpost_count_with_op_bishop * BISHOP_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG;
-    score.eg_score += bishop_outpost_count_with_op_bishop * BISHOP_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG;
-    score.mg_score += knight_outpost_count_no_op_bishop * KNIGHT_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_MG;
-    score.eg_score += knight_outpost_count_no_op_bishop * KNIGHT_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_EG;
-    score.mg_score += knight_outpost_count_with_op_bishop * KNIGHT_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG;
-    score.eg_score += knight_outpost_count_with_op_bishop * KNIGHT_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_EG;
+    score += bishop_outpost_count_no_op_bishop * EvaluationResult(BISHOP_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_MG, BISHOP_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_EG);
+    score += bishop_outpost_count_with_op_bishop * EvaluationResult(BISHOP_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG, BISHOP_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG);
+    score += knight_outpost_count_no_op_bishop * EvaluationResult(KNIGHT_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_MG, KNIGHT_OUTPOST_BONUS_NO_OPPOSITE_BISHOP_EG);
+    score += knight_outpost_count_with_op_bishop * EvaluationResult(KNIGHT_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_MG, KNIGHT_OUTPOST_BONUS_WITH_OPPOSITE_BISHOP_EG);
 
     return score;
 }
 static EvaluationResult evaluate_pawns(EvalContext& ctx) {
     EvaluationResult score = { 0,0 };
     uint64_t pawn_key = ctx.board.get_pawn_key();
-    int idx = pawn_key & (PAWN_HASH_SIZE - 1);
-    PawnEvalEntry& entry = get_pawn_entry(idx);  // Gendert
-    if (!(entry.valid && entry.key == pawn_key)) {
+    PawnEvalEntry& entry = get_pawn_entry(pawn_key);
+    bool hit = entry.valid && entry.key == pawn_key;
+    record_pawn_probe(hit);
+    if (!hit) {
         entry = compute_pawn_eval_entry(ctx);
     }
     else {
@@ -952,30 +766,153 @@ static EvaluationResult evaluate_pawns(EvalContext& ctx) {
         ctx.backward_pawns[1] = entry.backward_pawns[1];
     }
 
-    score += entry.isolated_passed_score + entry.backward_score + entry.doubled_score;
+    score += entry.score;
     return score;
 }
+#ifdef ENGINE_STATS
+// Unscaled, for the per-term histograms
 static int tapered(EvaluationResult score, int game_phase) {
-    return (score.mg_score * game_phase + score.eg_score * (24 - game_phase)) / 24;
+    return (score.mg_score() * game_phase + score.eg_score() * (24 - game_phase)) / 24;
 }
-int evaluate(const Board& board, uint8_t terms_mask) {
+#endif
+// Tapered score with the endgame half scaled down when the stronger side's material is drawish
+static int tapered(EvaluationResult score, const MaterialEntry& material, const Board& board) {
+    int eg_score = score.eg_score();
+    EndgameScaleFn scale = material.endgame_scale[eg_score >= 0 ? 0 : 1];
+    if (scale) eg_score = eg_score * scale(board) / endgame::SCALE_NORMAL;
+    return (score.mg_score() * material.game_phase + eg_score * (24 - material.game_phase)) / 24;
+}
+// White-relative network score; boards set up before the network was loaded have no accumulator
+static int evaluate_nnue(const Board& board) {
+    const nnue::Accumulator* accumulator = board.get_accumulator();
+    nnue::Accumulator scratch;
+    if (!accumulator) {
+        nnue::refresh(scratch, board.get_pieces_table());
+        accumulator = &scratch;
+    }
+    // Kept clear of mate scores, which are also what the int16 eval cache can hold
+    int score = std::clamp(nnue::evaluate(*accumulator, board.get_turn()), -(MATE_THRESHOLD - 1), MATE_THRESHOLD - 1);
+    return board.get_turn() == Color::WHITE ? score : -score;
+}
+// Terms that need the attack maps; they also read the pawn sets evaluate_pawns leaves in the context
+constexpr uint8_t EVAL_PIECE_TERMS = EVAL_KING_SAFETY | EVAL_MOBILITY | EVAL_ROOK_ACTIVITY | EVAL_MINOR_PIECES;
+
+// Material, PST, pawn structure and the material-hash imbalance: incremental or hashed, so nearly free
+template <uint8_t Terms>
+static EvaluationResult evaluate_cheap_terms(EvalContext& ctx, const MaterialEntry& material) {
     EvaluationResult score = { 0,0 };
-    struct EvalContext ctx(board);
+    auto add = [&]([[maybe_unused]] eval_stats::Term term, EvaluationResult value) {
+#ifdef ENGINE_STATS
+        eval_stats::record(term, tapered(value, material.game_phase));
+#endif
+        score += value;
+    };
+    if constexpr ((Terms & EVAL_MATERIAL) != 0) add(eval_stats::Term::Material, evaluate_material(ctx));
+    if constexpr ((Terms & EVAL_POSITIONAL) != 0) add(eval_stats::Term::Positional, evaluate_positional(ctx.board));
+    if constexpr ((Terms & EVAL_PAWN_STRUCTURE) != 0) add(eval_stats::Term::PawnStructure, evaluate_pawns(ctx));
+    if constexpr ((Terms & EVAL_MINOR_PIECES) != 0) add(eval_stats::Term::Imbalance, material.imbalance); // bishop pair
+    return score;
+}
+template <uint8_t Terms>
+static EvaluationResult evaluate_piece_terms(EvalContext& ctx, [[maybe_unused]] const MaterialEntry& material) {
+    EvaluationResult score = { 0,0 };
+    auto add = [&]([[maybe_unused]] eval_stats::Term term, EvaluationResult value) {
+#ifdef ENGINE_STATS
+        eval_stats::record(term, tapered(value, material.game_phase));
+#endif
+        score += value;
+    };
+    if constexpr ((Terms & EVAL_PIECE_TERMS) != 0) ctx.compute_attack_maps();
+    if constexpr ((Terms & EVAL_KING_SAFETY) != 0) add(eval_stats::Term::KingSafety, eval_king_safety_score(ctx));
+    if constexpr ((Terms & EVAL_MOBILITY) != 0) add(eval_stats::Term::Mobility, evaluate_mobility(ctx));
+    if constexpr ((Terms & EVAL_ROOK_ACTIVITY) != 0) add(eval_stats::Term::RookActivity, evaluate_rook_activity(ctx));
+    if constexpr ((Terms & EVAL_MINOR_PIECES) != 0) {
+        add(eval_stats::Term::BadBishop, evaluate_bad_bishop(ctx));
+        add(eval_stats::Term::Fianchetto, evaluate_fianchetto_bishop(ctx));
+        add(eval_stats::Term::TrappedMinors, evaluate_trapped_minor_pieces(ctx));
+        add(eval_stats::Term::Outpost, evaluate_outpost(ctx));
+    }
+    return score;
+}
+template <uint8_t Terms>
+int evaluate(const Board& board) {
+    static_assert((Terms & EVAL_PIECE_TERMS) == 0 || (Terms & EVAL_PAWN_STRUCTURE) != 0,
+        "the piece terms read the pawn structure computed by evaluate_pawns");
+    // The network score does not depend on the mask, so every mask shares the full evaluation's slot
+    const uint64_t key = eval_cache_key(board, nnue::is_enabled() ? uint8_t(EvalAll) : Terms);
+    int score;
+    if (probe_eval_cache(key, score)) return score;
+
+    const MaterialEntry& material = probe_material(board);
+    if (material.endgame_eval) return material.endgame_eval(board);
+    // For every mask, so the static eval behind the RFP and futility margins is the score the leaves return
+    if (nnue::is_enabled()) {
+        score = evaluate_nnue(board);
+        store_eval_cache(key, score);
+        return score;
+    }
 
-	score += evaluate_material(ctx);
-    score += evaluate_positional(board);
-    score += evaluate_pawns(ctx);
-    if (terms_mask != EvalAll) return tapered(score,ctx.game_phase);
-	score += eval_king_safety_score(ctx);
-	score += evaluate_mobility(ctx);
-	score += evaluate_rook_activity(ctx);
-	score+=evaluate_bishop_pair(ctx);
-	score+=evaluate_bad_bishop(ctx);
-	score+=evaluate_fianchetto_bishop(ctx);
-	score+=evaluate_trapped_minor_pieces(ctx);
-	score+=evaluate_outpost(ctx);
+    struct EvalContext ctx(board);
+    EvaluationResult terms = evaluate_cheap_terms<Terms>(ctx, material);
+    terms += evaluate_piece_terms<Terms>(ctx, material);
+    score = tapered(terms, material, board);
+#ifdef ENGINE_STATS
+    if constexpr (Terms == EvalAll) eval_stats::record(eval_stats::Term::Total, score);
+#endif
+    store_eval_cache(key, score);
+    return score;
+}
+template int evaluate<EvalAll>(const Board& board);
+template int evaluate<EvalCheap>(const Board& board);
+
+int evaluate(const Board& board, int alpha, int beta) {
+    const int sign = board.is_white_to_move() ? 1 : -1;
+    const uint64_t key = eval_cache_key(board, EvalAll);
+    int cached_score;
+    if (probe_eval_cache(key, cached_score)) return sign * cached_score;
+
+    const MaterialEntry& material = probe_material(board);
+    if (material.endgame_eval) return sign * material.endgame_eval(board);
+    if (nnue::is_enabled()) {
+        int nnue_score = evaluate_nnue(board);
+        store_eval_cache(key, nnue_score);
+        return sign * nnue_score;
+    }
 
-	return tapered(score, ctx.game_phase);
+    struct EvalContext ctx(board);
+    EvaluationResult score = evaluate_cheap_terms<EvalAll>(ctx, material);
+    int lazy_score = sign * tapered(score, material, board);
+    bool early_exit = lazy_score + LAZY_EVAL_MARGIN <= alpha || lazy_score - LAZY_EVAL_MARGIN >= beta;
+    record_lazy_eval(early_exit);
+    if (early_exit) return lazy_score;
+
+    score += evaluate_piece_terms<EvalAll>(ctx, material);
+    int full_score = tapered(score, material, board);
+#ifdef ENGINE_STATS
+    eval_stats::record(eval_stats::Term::Total, full_score);
+#endif
+    store_eval_cache(key, full_score);
+	return sign * full_score;
+}
+EvalStats get_eval_stats() {
+    return {
+        eval_counters[LAZY_CALLS].load(std::memory_order_relaxed),
+        eval_counters[LAZY_EXITS].load(std::memory_order_relaxed),
+        eval_counters[CACHE_PROBES].load(std::memory_order_relaxed),
+        eval_counters[CACHE_HITS].load(std::memory_order_relaxed),
+        eval_counters[PAWN_PROBES].load(std::memory_order_relaxed),
+        eval_counters[PAWN_HITS].load(std::memory_order_relaxed),
+    };
+}
+void flush_eval_stats() {
+    flush_eval_counters();
+}
+void reset_eval_stats() {
+    for (auto& counter : tls_eval_counters) counter = 0;
+    for (auto& counter : eval_counters) counter.store(0, std::memory_order_relaxed);
+}
+void invalidate_eval_caches() {
+    eval_cache_epoch.fetch_add(1, std::memory_order_relaxed);
 }
 
 static PawnEvalEntry compute_pawn_eval_entry(EvalContext& ctx) {
@@ -983,9 +920,10 @@ static PawnEvalEntry compute_pawn_eval_entry(EvalContext& ctx) {
     entry.key = ctx.board.get_pawn_key();
     entry.valid = true;
 
-    entry.isolated_passed_score = eval_iso_passed_pawns(ctx);
-    entry.doubled_score = eval_double_pawns(ctx);
-	entry.backward_score = eval_backward_pawns(ctx);
+    // Sequenced: the backward-pawn term skips the passed and isolated pawns found by the first
+    entry.score = eval_iso_passed_pawns(ctx);
+    entry.score += eval_double_pawns(ctx);
+	entry.score += eval_backward_pawns(ctx);
         
     entry.isolated_pawns[0] = ctx.isolated_pawns[0];
     entry.isolated_pawns[1] = ctx.isolated_pawns[1];
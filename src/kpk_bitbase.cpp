@@ -0,0 +1,166 @@
+#include "kpk_bitbase.h"
+#include <algorithm>
+#include <atomic>
+#include <barrier>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "attack_rays.h"
+#include "utils.h"
+
+namespace kpk {
+namespace {
+    // Positions are normalised to a white pawn on files a-d, ranks 2-7:
+    // index = white king | black king << 6 | side to move << 12 | file << 13 | (rank 7 - rank) << 15
+    constexpr int MAX_INDEX = 2 * 24 * 64 * 64;
+    constexpr int WHITE = 0;
+    constexpr int BLACK = 1;
+    uint32_t win_bits[MAX_INDEX / 32];
+
+    // Bit values so the successors of a position can be OR-ed together
+    enum Result : uint8_t { INVALID = 0, UNKNOWN = 1, DRAW = 2, WIN = 4 };
+
+    int index(int side_to_move, int black_king, int white_king, int pawn) {
+        return white_king | (black_king << 6) | (side_to_move << 12) | ((pawn % 8) << 13) | ((6 - pawn / 8) << 15);
+    }
+    struct Position {
+        int white_king;
+        int black_king;
+        int side_to_move;
+        int pawn;
+
+        explicit Position(int idx)
+            : white_king(idx & 63),
+            black_king((idx >> 6) & 63),
+            side_to_move((idx >> 12) & 1),
+            pawn(((idx >> 13) & 3) + 8 * (6 - ((idx >> 15) & 7))) {}
+    };
+
+    // Everything decidable without looking at successors: illegal positions, immediate safe
+    // promotions, stalemates and undefended pawns the black king can take
+    Result initial_result(int idx) {
+        Position p(idx);
+        int push = p.pawn + 8;
+        if (king_distance(p.white_king, p.black_king) <= 1 || p.white_king == p.pawn || p.black_king == p.pawn
+            || (p.side_to_move == WHITE && (PAWN_ATTACKS[WHITE][p.pawn] & bit64(p.black_king)))) {
+            return INVALID;
+        }
+        if (p.side_to_move == WHITE && p.pawn / 8 == 6 && p.white_king != push
+            && (king_distance(p.black_king, push) > 1 || king_distance(p.white_king, push) == 1)) {
+            return WIN;
+        }
+        if (p.side_to_move == BLACK) {
+            uint64_t covered = KING_ATTACKS[p.white_king] | PAWN_ATTACKS[WHITE][p.pawn];
+            if (!(KING_ATTACKS[p.black_king] & ~covered)) return DRAW;
+            if (KING_ATTACKS[p.black_king] & bit64(p.pawn) & ~KING_ATTACKS[p.white_king]) return DRAW;
+        }
+        return UNKNOWN;
+    }
+
+    uint8_t load(uint8_t& result) {
+        return std::atomic_ref<uint8_t>(result).load(std::memory_order_relaxed);
+    }
+    // White wins if any move wins, black draws if any move draws; illegal successors add nothing
+    Result resolve(std::vector<uint8_t>& db, int idx) {
+        Position p(idx);
+        const uint8_t good = p.side_to_move == WHITE ? WIN : DRAW;
+        const uint8_t bad = p.side_to_move == WHITE ? DRAW : WIN;
+        uint8_t successors = INVALID;
+        uint64_t king_moves = KING_ATTACKS[p.side_to_move == WHITE ? p.white_king : p.black_king];
+        while (king_moves) {
+            int to = get_lsb(king_moves);
+            successors |= p.side_to_move == WHITE
+                ? load(db[index(BLACK, p.black_king, to, p.pawn)])
+                : load(db[index(WHITE, to, p.white_king, p.pawn)]);
+            king_moves &= king_moves - 1;
+        }
+        if (p.side_to_move == WHITE) {
+            int push = p.pawn + 8;
+            if (p.pawn / 8 < 6) successors |= load(db[index(BLACK, p.black_king, p.white_king, push)]);
+            if (p.pawn / 8 == 1 && push != p.white_king && push != p.black_king) {
+                successors |= load(db[index(BLACK, p.black_king, p.white_king, push + 8)]);
+            }
+        }
+        return (successors & good) ? Result(good) : (successors & UNKNOWN) ? UNKNOWN : Result(bad);
+    }
+
+    // Each thread owns a slice of the index range and every pass ends at a barrier. Results only
+    // ever move from UNKNOWN to final, so reading a neighbour's stale entry just defers it a pass.
+    BitbaseStats build_bitbase() {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<uint8_t> db(MAX_INDEX);
+        const int threads = std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 1, 4);
+        std::atomic<bool> pass_changed{ false };
+        bool done = false;
+        int passes = 0;
+        std::barrier sync(threads, [&]() noexcept {
+            done = !pass_changed.exchange(false, std::memory_order_relaxed);
+            passes++;
+        });
+
+        auto worker = [&](int thread_index) {
+            const int begin = MAX_INDEX / threads * thread_index;
+            const int end = thread_index == threads - 1 ? MAX_INDEX : begin + MAX_INDEX / threads;
+            // Later passes only revisit the positions still unknown
+            std::vector<int> unknown;
+            for (int idx = begin; idx < end; ++idx) {
+                Result result = initial_result(idx);
+                std::atomic_ref<uint8_t>(db[idx]).store(result, std::memory_order_relaxed);
+                if (result == UNKNOWN) unknown.push_back(idx);
+            }
+            pass_changed.store(true, std::memory_order_relaxed);
+            sync.arrive_and_wait();
+            while (!done) {
+                size_t remaining = 0;
+                for (int idx : unknown) {
+                    Result result = resolve(db, idx);
+                    if (result == UNKNOWN) unknown[remaining++] = idx;
+                    else std::atomic_ref<uint8_t>(db[idx]).store(result, std::memory_order_relaxed);
+                }
+                if (remaining != unknown.size()) pass_changed.store(true, std::memory_order_relaxed);
+                unknown.resize(remaining);
+                sync.arrive_and_wait();
+            }
+        };
+        std::vector<std::thread> helpers;
+        for (int t = 1; t < threads; ++t) helpers.emplace_back(worker, t);
+        worker(0);
+        for (auto& helper : helpers) helper.join();
+
+        for (int idx = 0; idx < MAX_INDEX; ++idx) {
+            if (db[idx] == WIN) win_bits[idx / 32] |= 1u << (idx % 32);
+        }
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        // The first barrier closes the initial classification, not a pass
+        return { size_t(MAX_INDEX), sizeof(win_bits), threads, passes - 1, elapsed.count() };
+    }
+
+    std::once_flag built;
+    BitbaseStats bitbase_stats{};
+}
+
+void init() {
+    std::call_once(built, [] { bitbase_stats = build_bitbase(); });
+}
+
+bool probe(Color strong, int strong_king, int pawn, int weak_king, Color side_to_move) {
+    // Flip so the pawn is white and on files a-d
+    if (strong == Color::BLACK) {
+        strong_king ^= 56;
+        pawn ^= 56;
+        weak_king ^= 56;
+    }
+    if (pawn % 8 > 3) {
+        strong_king ^= 7;
+        pawn ^= 7;
+        weak_king ^= 7;
+    }
+    int idx = index(side_to_move == strong ? WHITE : BLACK, weak_king, strong_king, pawn);
+    return (win_bits[idx / 32] >> (idx % 32)) & 1;
+}
+
+const BitbaseStats& get_bitbase_stats() {
+    return bitbase_stats;
+}
+}
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <string>
 #include "board.h"
 #include "utils.h"    
 #include "constants.h" 
@@ -9,18 +10,28 @@
 #include "notation_utils.h"
 #include "evaluation.h"
 #include "engine.h"
-#include "rook_tables.h"
-#include "bishop_tables.h"
 #include <chrono>
 #include "prepare_data.h"
 #include <vector>
 #include "uci.h"
 #include "see.h"
 #include "Squares.h"
+#include "kpk_bitbase.h"
 
 #include <iostream>
 int main(int argc, char* argv[]) {
-    Zobrist::initialize_keys();
+    // One-off report of the start-up table builds, kept out of the normal UCI start-up output
+    if (argc > 1 && std::string(argv[1]) == "--table-stats") {
+        const SliderTableStats& slider_stats = get_slider_table_stats();
+        std::cout << "Slider attack tables: " << slider_stats.entries << " entries ("
+            << slider_stats.bytes / 1024 << " KB) built in " << slider_stats.build_ms << " ms\n";
+        kpk::init();
+        const kpk::BitbaseStats& kpk_stats = kpk::get_bitbase_stats();
+        std::cout << "KPK bitbase: " << kpk_stats.positions << " positions (" << kpk_stats.bytes / 1024
+            << " KB) built in " << kpk_stats.build_ms << " ms, " << kpk_stats.passes << " passes on "
+            << kpk_stats.threads << " threads\n";
+        return 0;
+    }
         std::ios::sync_with_stdio(false);
         std::cin.tie(nullptr);
         uci_loop();
@@ -0,0 +1,171 @@
+#include "nnue.h"
+#include <cstring>
+#include <fstream>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace nnue {
+namespace {
+    struct alignas(64) Network {
+        int16_t feature_weights[INPUT_SIZE][HIDDEN_SIZE];
+        int16_t feature_biases[HIDDEN_SIZE];
+        int8_t output_weights[2 * HIDDEN_SIZE];
+        int32_t output_bias;
+    };
+    // Allocated on the first successful load; read-only while searching
+    Network* network = nullptr;
+    bool use_network = true;
+
+    constexpr char FILE_MAGIC[4] = { 'C', 'B', 'N', 'N' };
+    constexpr uint32_t FILE_VERSION = 1;
+
+    template <typename T>
+    bool read_array(std::ifstream& in, T* data, size_t count) {
+        in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+        return static_cast<bool>(in);
+    }
+
+    // values += sign * weights, HIDDEN_SIZE lanes of int16
+    template <bool add>
+    inline void apply_weights(int16_t* values, const int16_t* weights) {
+#if defined(__AVX2__)
+        for (int i = 0; i < HIDDEN_SIZE; i += 16) {
+            __m256i v = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i w = _mm256_load_si256(reinterpret_cast<const __m256i*>(weights + i));
+            v = add ? _mm256_add_epi16(v, w) : _mm256_sub_epi16(v, w);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(values + i), v);
+        }
+#elif defined(__ARM_NEON)
+        for (int i = 0; i < HIDDEN_SIZE; i += 8) {
+            int16x8_t v = vld1q_s16(values + i);
+            int16x8_t w = vld1q_s16(weights + i);
+            vst1q_s16(values + i, add ? vaddq_s16(v, w) : vsubq_s16(v, w));
+        }
+#else
+        for (int i = 0; i < HIDDEN_SIZE; ++i) values[i] = add ? int16_t(values[i] + weights[i]) : int16_t(values[i] - weights[i]);
+#endif
+    }
+
+    // Sum over i of clamp(values[i], 0, ACTIVATION_CLIP) * weights[i]
+    inline int32_t clipped_dot(const int16_t* values, const int8_t* weights) {
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i clip = _mm256_set1_epi16(ACTIVATION_CLIP);
+        const __m256i ones = _mm256_set1_epi16(1);
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < HIDDEN_SIZE; i += 32) {
+            __m256i low = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i));
+            __m256i high = _mm256_load_si256(reinterpret_cast<const __m256i*>(values + i + 16));
+            low = _mm256_min_epi16(_mm256_max_epi16(low, zero), clip);
+            high = _mm256_min_epi16(_mm256_max_epi16(high, zero), clip);
+            // packus interleaves the 128-bit lanes; the permute restores neuron order
+            __m256i activations = _mm256_permute4x64_epi64(_mm256_packus_epi16(low, high), 0xD8);
+            __m256i w = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(weights + i));
+            // u8 * i8 pairs fit int16 because activations are at most 127
+            __m256i products = _mm256_maddubs_epi16(activations, w);
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(products, ones));
+        }
+        __m128i reduced = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+        reduced = _mm_add_epi32(reduced, _mm_shuffle_epi32(reduced, 0x4E));
+        reduced = _mm_add_epi32(reduced, _mm_shuffle_epi32(reduced, 0xB1));
+        return _mm_cvtsi128_si32(reduced);
+#elif defined(__ARM_NEON)
+        const int16x8_t zero = vdupq_n_s16(0);
+        const int16x8_t clip = vdupq_n_s16(ACTIVATION_CLIP);
+        int32x4_t sum = vdupq_n_s32(0);
+        for (int i = 0; i < HIDDEN_SIZE; i += 8) {
+            int16x8_t activations = vminq_s16(vmaxq_s16(vld1q_s16(values + i), zero), clip);
+            int16x8_t w = vmovl_s8(vld1_s8(weights + i));
+            sum = vmlal_s16(sum, vget_low_s16(activations), vget_low_s16(w));
+            sum = vmlal_s16(sum, vget_high_s16(activations), vget_high_s16(w));
+        }
+        return vaddvq_s32(sum);
+#else
+        int32_t sum = 0;
+        for (int i = 0; i < HIDDEN_SIZE; ++i) {
+            int activation = values[i] < 0 ? 0 : (values[i] > ACTIVATION_CLIP ? ACTIVATION_CLIP : values[i]);
+            sum += activation * weights[i];
+        }
+        return sum;
+#endif
+    }
+}
+
+bool load(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+
+    char magic[4];
+    uint32_t version = 0, input_size = 0, hidden_size = 0;
+    if (!read_array(in, magic, 4) || std::memcmp(magic, FILE_MAGIC, 4) != 0) return false;
+    if (!read_array(in, &version, 1) || !read_array(in, &input_size, 1) || !read_array(in, &hidden_size, 1)) return false;
+    if (version != FILE_VERSION || input_size != INPUT_SIZE || hidden_size != HIDDEN_SIZE) return false;
+
+    // Read into a scratch network so a truncated file leaves the current one untouched
+    Network* loaded = new Network;
+    bool ok = read_array(in, &loaded->feature_weights[0][0], size_t(INPUT_SIZE) * HIDDEN_SIZE)
+        && read_array(in, loaded->feature_biases, HIDDEN_SIZE)
+        && read_array(in, loaded->output_weights, 2 * HIDDEN_SIZE)
+        && read_array(in, &loaded->output_bias, 1);
+    if (!ok) {
+        delete loaded;
+        return false;
+    }
+    delete network;
+    network = loaded;
+    return true;
+}
+bool is_loaded() {
+    return network != nullptr;
+}
+void set_enabled(bool enabled) {
+    use_network = enabled;
+}
+bool is_enabled() {
+    return use_network && network != nullptr;
+}
+
+void refresh(Accumulator& accumulator, const std::array<std::array<uint64_t, 6>, 2>& pieces) {
+    for (int perspective = 0; perspective < 2; ++perspective) {
+        int16_t* values = accumulator.values[perspective];
+        std::memcpy(values, network->feature_biases, sizeof(network->feature_biases));
+        for (int color = 0; color < 2; ++color) {
+            for (int piece = 0; piece < 6; ++piece) {
+                uint64_t bitboard = pieces[color][piece];
+                while (bitboard) {
+                    int index = feature_index(Color(perspective), Color(color), PieceType(piece), get_lsb(bitboard));
+                    apply_weights<true>(values, network->feature_weights[index]);
+                    bitboard &= bitboard - 1;
+                }
+            }
+        }
+    }
+}
+
+void update(Accumulator& out, const Accumulator& in,
+    const FeatureChange* added, int added_count, const FeatureChange* removed, int removed_count) {
+    std::memcpy(&out, &in, sizeof(Accumulator));
+    for (int perspective = 0; perspective < 2; ++perspective) {
+        int16_t* values = out.values[perspective];
+        for (int i = 0; i < added_count; ++i) {
+            const FeatureChange& f = added[i];
+            apply_weights<true>(values, network->feature_weights[feature_index(Color(perspective), f.color, f.piece, f.square)]);
+        }
+        for (int i = 0; i < removed_count; ++i) {
+            const FeatureChange& f = removed[i];
+            apply_weights<false>(values, network->feature_weights[feature_index(Color(perspective), f.color, f.piece, f.square)]);
+        }
+    }
+}
+
+int evaluate(const Accumulator& accumulator, Color side_to_move) {
+    int us = to_int(side_to_move);
+    int32_t output = clipped_dot(accumulator.values[us], network->output_weights)
+        + clipped_dot(accumulator.values[us ^ 1], network->output_weights + HIDDEN_SIZE)
+        + network->output_bias;
+    return static_cast<int>(int64_t(output) * EVAL_SCALE / (ACTIVATION_CLIP * OUTPUT_WEIGHT_SCALE));
+}
+}
@@ -0,0 +1,223 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "board.h"
+#include "constants.h"
+#include "engine.h"
+#include "Move.h"
+#include "MoveGenerator.h"
+#include "nnue.h"
+#include "uci.h"
+#include "uci_helpers.h"
+
+// Perft regression and move generation throughput suite.
+// Every position is walked twice: a shallow pass that checks the incremental state against a
+// recomputation after each make_move and against the pre-move snapshot after each undo_move, and a
+// timed single-threaded bulk-counting pass whose node count must match the reference. The engine's
+// multithreaded, hashed perft (the UCI "go perft" path) is then run on the same position and must agree.
+// When the default network file is present its accumulators are verified too, but kept out of the timed pass.
+// The shallow pass also checks that the quiescence generator (captures plus checks) yields exactly the
+// legal captures and checking quiet moves, and a few named positions pin down checking promotions.
+// One "key=value" line is printed per position so the output can be diffed and parsed.
+
+struct SuiteCase {
+    const char* name;
+    int depth;
+    uint64_t expected_nodes;
+    int verify_depth;
+};
+
+static constexpr SuiteCase SUITE[] = {
+    {"startpos", 6, 119060324ULL, 4},
+    {"kiwipete", 5, 193690690ULL, 3},
+    {"perft2",   6, 11030083ULL,  5},
+    {"perft3",   5, 15833292ULL,  4},
+    {"perft4",   5, 89941194ULL,  3},
+    {"perft5",   5, 164075551ULL, 3},
+};
+
+// Quiescence generator output in positions whose only forcing moves are quiet promotions
+struct CheckCase {
+    const char* name;
+    const char* fen;
+    const char* expected_moves; // sorted UCI moves
+};
+
+static constexpr CheckCase CHECK_CASES[] = {
+    {"knight_fork",   "8/4P1k1/3q4/8/8/8/8/7K w - - 0 1", "e7e8n"},
+    {"back_rank",     "1k6/3P4/8/8/8/8/8/7K w - - 0 1",   "d7d8q d7d8r"},
+    {"vacated_file",  "8/3P4/8/8/8/8/8/K2k4 w - - 0 1",   "d7d8q d7d8r"},
+    {"black_promo",   "7k/8/8/8/8/8/3p4/1K6 b - - 0 1",   "d2d1q d2d1r"},
+};
+
+static MoveList suite_lists[64];
+
+static std::string find_fen(const char* name) {
+    if (std::strcmp(name, "startpos") == 0) return STARTING_FEN;
+    for (const auto& preset : DEFAULT_POSITIONS) {
+        if (std::strcmp(name, preset.name) == 0) return preset.fen;
+    }
+    return "";
+}
+
+static uint64_t count_nodes(Board& board, int depth, int ply) {
+    if (depth == 0) return 1;
+    if (depth == 1) return static_cast<uint64_t>(MoveGenerator::count_legal_moves(board));
+
+    MoveList& moves = suite_lists[ply];
+    moves.clear();
+    MoveGenerator::generate_moves(board, moves);
+
+    uint64_t nodes = 0;
+    for (const Move& move : moves) {
+        board.make_move(move);
+        nodes += count_nodes(board, depth - 1, ply + 1);
+        board.undo_move(move);
+    }
+    return nodes;
+}
+
+static bool same_move(const Move& a, const Move& b) {
+    return a.from_square == b.from_square && a.to_square == b.to_square && a.promotion_piece == b.promotion_piece;
+}
+
+static std::string sorted_uci(const MoveList& moves) {
+    std::vector<std::string> names;
+    for (const Move& move : moves) names.push_back(move_to_uci(move));
+    std::sort(names.begin(), names.end());
+    std::string joined;
+    for (const std::string& name : names) joined += (joined.empty() ? "" : " ") + name;
+    return joined;
+}
+
+// Castling is left out: the quiescence generator never castles, checking or not
+static int verify_check_moves(const Board& board, const MoveList& legal, int& reported) {
+    MoveList generated;
+    MoveGenerator::generate_captures_with_checks(board, generated);
+    int expected = 0;
+    int errors = 0;
+    for (const Move& move : legal) {
+        if (move.is_castle) continue;
+        if (move.piece_captured == PieceType::NONE && !move.is_en_passant && !board.gives_check(move)) continue;
+        expected++;
+        if (std::none_of(generated.begin(), generated.end(), [&](const Move& m) { return same_move(m, move); })) {
+            if (reported++ < 5) std::cerr << "quiescence generator misses " << move_to_uci(move) << "\n";
+            errors++;
+        }
+    }
+    int generated_count = static_cast<int>(std::count_if(generated.begin(), generated.end(), [](const Move& m) { return !m.is_castle; }));
+    if (generated_count != expected) {
+        if (reported++ < 5) std::cerr << "quiescence generator yields " << generated_count << " moves, expected " << expected << "\n";
+        errors++;
+    }
+    return errors;
+}
+
+// Returns the number of inconsistencies found and reports the first few on stderr
+static int verify_consistency(Board& board, int depth, int ply, int& reported) {
+    if (depth == 0) return 0;
+
+    MoveList& moves = suite_lists[ply];
+    moves.clear();
+    MoveGenerator::generate_moves(board, moves);
+
+    int errors = 0;
+    if (!board.in_check()) errors += verify_check_moves(board, moves, reported);
+    for (int i = 0; i < (int)moves.size(); ++i) {
+        const Move move = moves[i];
+        uint64_t hash = board.get_hash();
+        uint64_t pawn_key = board.get_pawn_key();
+        uint64_t material_key = board.get_material_key();
+        EvaluationResult material = board.get_material_score();
+        EvaluationResult positional = board.get_positional_score();
+
+        board.make_move(move);
+        if (const char* field = board.find_incremental_mismatch()) {
+            if (reported++ < 5) std::cerr << "incremental " << field << " mismatch after " << move_to_uci(move) << "\n";
+            errors++;
+        }
+        errors += verify_consistency(board, depth - 1, ply + 1, reported);
+        board.undo_move(move);
+
+        bool restored = board.get_hash() == hash
+            && board.get_pawn_key() == pawn_key
+            && board.get_material_key() == material_key
+            && board.get_material_score() == material
+            && board.get_positional_score() == positional;
+        if (!restored) {
+            if (reported++ < 5) std::cerr << "state not restored after undoing " << move_to_uci(move) << "\n";
+            errors++;
+        }
+    }
+    return errors;
+}
+
+int main() {
+    int failures = 0;
+    uint64_t total_nodes = 0;
+    double total_seconds = 0.0;
+    bool nnue_loaded = nnue::load(nnue::DEFAULT_EVAL_FILE);
+    std::cout << "perft nnue=" << (nnue_loaded ? "loaded" : "absent") << "\n";
+    Engine engine(16);
+    engine.set_threads(std::clamp(static_cast<int>(std::thread::hardware_concurrency()), 2, 4));
+
+    for (const SuiteCase& test : SUITE) {
+        std::string fen = find_fen(test.name);
+        nnue::set_enabled(true);
+        Board board(fen);
+
+        int reported = 0;
+        int inconsistencies = verify_consistency(board, test.verify_depth, 0, reported);
+        nnue::set_enabled(false);
+        board.refresh_accumulators();
+
+        auto start = std::chrono::steady_clock::now();
+        uint64_t nodes = count_nodes(board, test.depth, 0);
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        PerftRes threaded = engine.perft(board, test.depth);
+
+        bool ok = nodes == test.expected_nodes && threaded.nodes == test.expected_nodes && inconsistencies == 0;
+        if (!ok) failures++;
+        total_nodes += nodes;
+        total_seconds += elapsed.count();
+
+        uint64_t nps = elapsed.count() > 0 ? static_cast<uint64_t>(nodes / elapsed.count()) : 0;
+        std::cout << "perft name=" << test.name
+            << " depth=" << test.depth
+            << " nodes=" << nodes
+            << " expected=" << test.expected_nodes
+            << " time_ms=" << static_cast<uint64_t>(elapsed.count() * 1000.0)
+            << " nps=" << nps
+            << " threaded_nodes=" << threaded.nodes
+            << " threaded_ms=" << static_cast<uint64_t>(threaded.duration * 1000.0)
+            << " inconsistencies=" << inconsistencies
+            << " status=" << (ok ? "ok" : "FAIL") << "\n";
+        std::cout.flush();
+    }
+
+    for (const CheckCase& test : CHECK_CASES) {
+        Board board(test.fen);
+        MoveList generated;
+        MoveGenerator::generate_captures_with_checks(board, generated);
+        std::string moves = sorted_uci(generated);
+        bool ok = moves == test.expected_moves;
+        if (!ok) failures++;
+        std::cout << "qsearch name=" << test.name
+            << " moves=\"" << moves << "\""
+            << " expected=\"" << test.expected_moves << "\""
+            << " status=" << (ok ? "ok" : "FAIL") << "\n";
+    }
+
+    uint64_t total_nps = total_seconds > 0 ? static_cast<uint64_t>(total_nodes / total_seconds) : 0;
+    std::cout << "perft total nodes=" << total_nodes
+        << " time_ms=" << static_cast<uint64_t>(total_seconds * 1000.0)
+        << " nps=" << total_nps
+        << " failures=" << failures << "\n";
+    return failures == 0 ? 0 : 1;
+}
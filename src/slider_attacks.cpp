@@ -0,0 +1,135 @@
+#include "slider_attacks.h"
+#include "utils.h"
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <vector>
+
+SliderMagic BISHOP_MAGICS[64];
+SliderMagic ROOK_MAGICS[64];
+
+namespace {
+    constexpr uint64_t BISHOP_MAGIC_NUMBERS[64] = {
+    0x40020c0118010300ULL, 0x1e3001120882052eULL, 0x1404080083000004ULL, 0x5c4100a0000100ULL,
+    0x80041421002802c1ULL, 0x1048282848000100ULL, 0x804020802480902ULL, 0xc200442034aaULL,
+    0x504a60040a8210ULL, 0x28820810040880a0ULL, 0x2004900c84810122ULL, 0x48110400800011ULL,
+    0xc0204d1040000000ULL, 0x810006022221c044ULL, 0x80b0090900800ULL, 0x10010242100c00ULL,
+    0x20001202100101ULL, 0x206051030c040088ULL, 0x80900c0884620120ULL, 0x8000082004400ULL,
+    0x1c0900404201040ULL, 0x1000201a10100820ULL, 0x225020448061060ULL, 0x2000820100481280ULL,
+    0x420645920440480ULL, 0x80a000c100201ULL, 0x1004620004040400ULL, 0x2242008048008022ULL,
+    0x4011004014004041ULL, 0x2100c0810820100ULL, 0x208230204434800ULL, 0x1aa0000210c00ULL,
+    0x1104000502408ULL, 0x8028021000080308ULL, 0x200211000010408ULL, 0x1010181800020a00ULL,
+    0x404104011040100ULL, 0x20204010084300cULL, 0x20102931004208a4ULL, 0x2014048832008401ULL,
+    0x8420220065000ULL, 0x880bd40218022034ULL, 0x20420044014048ULL, 0x401100c202803804ULL,
+    0x8000982009000822ULL, 0xa808050800882200ULL, 0x1120222202000040ULL, 0x8092204010288d0ULL,
+    0x4084040a08042810ULL, 0x340020821010a018ULL, 0x10020a8068080104ULL, 0xa890400108480010ULL,
+    0x801410020a0024ULL, 0x10041c48060001ULL, 0x41100401004000ULL, 0x8102100550203ULL,
+    0xb2002402080509ULL, 0x4222012048ULL, 0x1001000242a1800ULL, 0x82021080840401ULL,
+    0x2800180044850406ULL, 0x830000e0a1061a80ULL, 0x8400c04803410210ULL, 0x20200c00444040ULL,
+    };
+    constexpr uint64_t ROOK_MAGIC_NUMBERS[64] = {
+    0x800040002c80b0ULL, 0x40082000300041ULL, 0x200220010804048ULL, 0x100100100200428ULL,
+    0x100150028003002ULL, 0x4900510002080400ULL, 0x100009600050004ULL, 0x20000c520810204ULL,
+    0x4440800080204000ULL, 0x12401001200042ULL, 0x49004031002000ULL, 0x8200803000180180ULL,
+    0x1800802401080080ULL, 0x61002400080300ULL, 0x1001401000200ULL, 0x9022800841800100ULL,
+    0x898000400468ULL, 0x100404010002000ULL, 0x8000808010006000ULL, 0x18400a0022004010ULL,
+    0xa001010048005004ULL, 0x2002008006800400ULL, 0x9060040002282110ULL, 0x208120000410294ULL,
+    0x940082080004492ULL, 0x400040201000ULL, 0x1040448200220010ULL, 0x1c01006100500028ULL,
+    0x2002004e00082010ULL, 0x400040080260080ULL, 0x804440101000200ULL, 0x4419060000c08cULL,
+    0x82a04000800180ULL, 0x22010842002081ULL, 0x1006420182002010ULL, 0xc400100081800800ULL,
+    0x2040082800800ULL, 0xa280040080800200ULL, 0x82204002510ULL, 0x4300804102000084ULL,
+    0x8504400080308004ULL, 0x2810004420004010ULL, 0x160003000808020ULL, 0x502001044a20008ULL,
+    0x4309000801050010ULL, 0x51005204010028ULL, 0x6500020930040018ULL, 0x228400420001ULL,
+    0x80008308402100ULL, 0x20004004a28080ULL, 0x114020010100ULL, 0x81120841220200ULL,
+    0x200050110280100ULL, 0x2c020c0082008080ULL, 0x4101460388100400ULL, 0xc81410400804200ULL,
+    0x8498800100a04011ULL, 0x21002604804012ULL, 0x41040a080102a02ULL, 0x10100088a1005085ULL,
+    0x8a0200a81020040aULL, 0x102000144081082ULL, 0x808080102100b84ULL, 0xe60090440100a2ULL,
+    };
+    constexpr int BISHOP_DIRECTIONS[4][2] = { {1,1},{1,-1},{-1,1},{-1,-1} };
+    constexpr int ROOK_DIRECTIONS[4][2] = { {1,0},{-1,0},{0,1},{0,-1} };
+
+    // Reference attack generation by walking each ray until it leaves the board or hits a blocker.
+    uint64_t sliding_attacks(int square, uint64_t occupied, const int (&directions)[4][2]) {
+        uint64_t attacks = 0;
+        for (const auto& direction : directions) {
+            int rank = square / 8 + direction[0];
+            int file = square % 8 + direction[1];
+            while (rank >= 0 && rank < 8 && file >= 0 && file < 8) {
+                uint64_t target = 1ULL << (rank * 8 + file);
+                attacks |= target;
+                if (occupied & target) break;
+                rank += direction[0];
+                file += direction[1];
+            }
+        }
+        return attacks;
+    }
+
+    // Relevant blockers: the empty-board attacks without the board edges the square is not on.
+    uint64_t blocker_mask(int square, const int (&directions)[4][2]) {
+        constexpr uint64_t RANK_1 = 0xFFULL, RANK_8 = 0xFFULL << 56;
+        constexpr uint64_t FILE_A = 0x0101010101010101ULL, FILE_H = FILE_A << 7;
+        uint64_t rank_edges = (RANK_1 | RANK_8) & ~(0xFFULL << (square / 8 * 8));
+        uint64_t file_edges = (FILE_A | FILE_H) & ~(FILE_A << (square % 8));
+        return sliding_attacks(square, 0, directions) & ~(rank_edges | file_edges);
+    }
+
+    // Fills the arena slice for each square: fancy magic (or PEXT) indices give every
+    // square a dense table of exactly 2^popcount(mask) entries, laid out back to back.
+    void build_tables(std::vector<SliderEntry>& arena, SliderMagic (&magics)[64],
+        const uint64_t (&magic_numbers)[64], const int (&directions)[4][2], size_t (&offsets)[64]) {
+        for (int square = 0; square < 64; ++square) {
+            SliderMagic& m = magics[square];
+            m.mask = blocker_mask(square, directions);
+#if defined(USE_PEXT)
+            (void)magic_numbers;
+            m.attack_mask = sliding_attacks(square, 0, directions);
+#else
+            m.magic = magic_numbers[square];
+            m.shift = 64 - popcount(m.mask);
+#endif
+            offsets[square] = arena.size();
+            arena.resize(arena.size() + (size_t(1) << popcount(m.mask)));
+            SliderEntry* table = arena.data() + offsets[square];
+
+            uint64_t subset = 0;
+            do {
+                uint64_t attacks = sliding_attacks(square, subset, directions);
+#if defined(USE_PEXT)
+                table[m.index(subset)] = static_cast<SliderEntry>(_pext_u64(attacks, m.attack_mask));
+#else
+                table[m.index(subset)] = attacks;
+#endif
+                subset = (subset - m.mask) & m.mask;
+            } while (subset);
+        }
+    }
+
+    SliderTableStats build_slider_tables() {
+        auto start = std::chrono::steady_clock::now();
+
+        std::vector<SliderEntry> arena;
+        arena.reserve(5248 + 102400);
+        size_t rook_offsets[64], bishop_offsets[64];
+        build_tables(arena, ROOK_MAGICS, ROOK_MAGIC_NUMBERS, ROOK_DIRECTIONS, rook_offsets);
+        build_tables(arena, BISHOP_MAGICS, BISHOP_MAGIC_NUMBERS, BISHOP_DIRECTIONS, bishop_offsets);
+
+        // One cache-line-aligned block for both pieces; it lives for the whole program.
+        size_t bytes = arena.size() * sizeof(SliderEntry);
+        SliderEntry* storage = static_cast<SliderEntry*>(::operator new[](bytes, std::align_val_t{ 64 }));
+        std::copy(arena.begin(), arena.end(), storage);
+        for (int square = 0; square < 64; ++square) {
+            ROOK_MAGICS[square].attacks = storage + rook_offsets[square];
+            BISHOP_MAGICS[square].attacks = storage + bishop_offsets[square];
+        }
+
+        std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        return { arena.size(), bytes, elapsed.count() };
+    }
+
+    const SliderTableStats slider_table_stats = build_slider_tables();
+}
+
+const SliderTableStats& get_slider_table_stats() {
+    return slider_table_stats;
+}
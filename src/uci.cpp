@@ -8,9 +8,12 @@
 
 #include "board.h"
 #include "engine.h"
+#include "evaluation.h"
+#include "eval_stats.h"
 #include "Move.h"
 #include "MoveGenerator.h"
 #include "constants.h"
+#include "nnue.h"
 #include "uci_helpers.h"  // move_to_uci, parse_uci_move
 #include "uci.h"
 
@@ -21,22 +24,6 @@
 #define GIT_BRANCH "unknown"
 #endif
 
-struct NamedPosition {
-    const char* name;
-    const char* fen;
-};
-
-static constexpr NamedPosition DEFAULT_POSITIONS[] = {
-    {"Qe3", "r4rk1/1b3ppp/p2pp3/4n1Q1/B1p1P3/P1N4P/1qP2PP1/R4RK1 w - - 0 18"},
-    {"a4", "8/8/6k1/ppppp1P1/5pK1/P1PP1P2/1P6/8 b - - 0 41"},
-    {"g5", "rnb1k2r/pp4p1/8/2bQPp2/5q1p/1PN4K/PB1PBPP1/R4R2 b kq - 3 21"},
-    {"kiwipete", "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1"},
-    {"perft2", "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1"},
-    {"perft3", "r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w kq - 0 1"},
-    {"perft4", "rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w KQ - 1 8"},
-    {"perft5", "r4rk1/1pp1qppp/p1np1n2/2b1p1B1/2B1P1b1/P1NP1N2/1PP1QPPP/R4RK1 w - - 0 10"}
-};
-
 static bool try_get_default_position(const std::string& name, std::string& out_fen) {
     for (const auto& preset : DEFAULT_POSITIONS) {
         if (name == preset.name) {
@@ -74,40 +61,17 @@ static void print_legal_moves(const Board& board) {
     std::cout << "\n";
     std::cout.flush();
 }
-// 64 is the maximum depth perft will ever reach
-MoveList perft_lists[64];
-
-// Add a 'ply' parameter to track how deep in the tree we are
-static uint64_t perft(Board& board, int depth, int ply = 0) {
-    if (depth == 0) {
-        return 1;
+// Loads the network, falling back to the classical evaluation when the file is missing or invalid
+static void load_eval_file(const std::string& path) {
+    if (nnue::load(path)) {
+        std::cout << "info string NNUE evaluation using " << path << "\n";
     }
-
-    // Grab the pre-allocated move list for this specific depth
-    MoveList& moves = perft_lists[ply];
-    moves.clear(); // Simply sets count = 0, virtually zero cost
-
-    MoveGenerator::generate_moves(board, moves);
-
-    if (depth == 1) {
-        return static_cast<uint64_t>(moves.size());
+    else {
+        std::cout << "info string NNUE file " << path << " not loaded, using classical evaluation\n";
     }
-
-    uint64_t nodes = 0;
-    for (const Move& move : moves) {
-        board.make_move(move);
-        // Pass ply + 1 to use the next pre-allocated list
-        nodes += perft(board, depth - 1, ply + 1);
-        board.undo_move(move);
-    }
-
-    return nodes;
+    std::cout.flush();
 }
-
-static void run_perft(const Board& root_board, int depth) {
-    Board board = root_board;
-    auto start = std::chrono::steady_clock::now();
-
+static void run_perft(Engine& engine, const Board& root_board, int depth) {
     if (depth < 0) {
         depth = 0;
     }
@@ -118,33 +82,26 @@ static void run_perft(const Board& root_board, int depth) {
         return;
     }
 
-    MoveList moves;
-    MoveGenerator::generate_moves(board, moves);
-
-    uint64_t total_nodes = 0;
-    for (const Move& move : moves) {
-        board.make_move(move);
-        uint64_t move_nodes = perft(board, depth - 1);
-        board.undo_move(move);
-
-        total_nodes += move_nodes;
-        std::cout << move_to_uci(move) << ": " << move_nodes << "\n";
+    // Root moves (and their replies on deep trees) are split across the engine's thread pool
+    std::vector<PerftDivide> divide;
+    PerftRes result = engine.perft(root_board, depth, &divide);
+    for (const PerftDivide& entry : divide) {
+        std::cout << move_to_uci(entry.move) << ": " << entry.nodes << "\n";
     }
 
-    auto end = std::chrono::steady_clock::now();
-    uint64_t elapsed_ms = static_cast<uint64_t>(
-        std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
-    uint64_t nps = elapsed_ms > 0 ? (total_nodes * 1000ULL) / elapsed_ms : 0;
+    uint64_t elapsed_ms = static_cast<uint64_t>(result.duration * 1000.0);
+    uint64_t nps = result.duration > 0 ? static_cast<uint64_t>(result.nodes / result.duration) : 0;
 
     std::cout << "\n";
     std::cout << "info string perft depth " << depth
-        << " nodes " << total_nodes
+        << " nodes " << result.nodes
         << " time " << elapsed_ms
         << " nps " << nps << "\n";
     std::cout.flush();
 }
 
 void uci_loop() {
+    load_eval_file(nnue::DEFAULT_EVAL_FILE);
     Board board;     // starts in startpos, thanks to default ctor
     Engine engine;
     std::thread search_thread;
@@ -157,6 +114,10 @@ void uci_loop() {
             std::cout << "option name Threads type spin default 1 min 1 max 256\n";
             std::cout << "option name Hash type spin default "
                 << MAX_MEMORY_TT_MB << " min 1 max 65536\n";
+            std::cout << "option name PawnHash type spin default "
+                << DEFAULT_PAWN_HASH_MB << " min 1 max 256\n";
+            std::cout << "option name UseNNUE type check default true\n";
+            std::cout << "option name EvalFile type string default " << nnue::DEFAULT_EVAL_FILE << "\n";
             std::cout << "uciok\n";
             std::cout.flush();
         }
@@ -172,6 +133,16 @@ void uci_loop() {
             wait_for_search(engine, search_thread);
             print_legal_moves(board);
         }
+        else if (line == "evalstats" || line == "evalstats reset") {
+            wait_for_search(engine, search_thread);
+#ifdef ENGINE_STATS
+            if (line == "evalstats") eval_stats::dump(std::cout);
+            else eval_stats::reset();
+#else
+            std::cout << "info string evalstats needs a build configured with -DENGINE_STATS=ON\n";
+            std::cout.flush();
+#endif
+        }
         else if (line == "presets") {
             wait_for_search(engine, search_thread);
             print_default_positions();
@@ -218,6 +189,23 @@ void uci_loop() {
                 engine.resize_tt(hash_mb);
                 std::cerr << "info string Hash set to " << hash_mb << " MB\n";
             }
+            else if (opt_name == "PawnHash") {
+                size_t pawn_hash_mb = std::stoull(opt_value);
+                pawn_hash_mb = std::max<size_t>(1, std::min<size_t>(pawn_hash_mb, 256));
+                engine.resize_pawn_hash(pawn_hash_mb);
+                std::cerr << "info string PawnHash set to " << pawn_hash_mb << " MB per thread\n";
+            }
+            else if (opt_name == "UseNNUE") {
+                nnue::set_enabled(opt_value == "true");
+                board.refresh_accumulators();
+                invalidate_eval_caches();
+                std::cerr << "info string UseNNUE set to " << (nnue::is_enabled() ? "true" : "false") << "\n";
+            }
+            else if (opt_name == "EvalFile") {
+                load_eval_file(opt_value);
+                board.refresh_accumulators();
+                invalidate_eval_caches();
+            }
         }
         else if (line.rfind("position", 0) == 0) {
             std::istringstream iss(line);
@@ -236,7 +224,11 @@ void uci_loop() {
                     if (!fen.empty()) fen += ' ';
                     fen += part;
                 }
-                board = Board(fen);
+                if (board.set_fen(fen) != FenError::None) {
+                    std::cout << "info string invalid fen " << fen << "\n";
+                    std::cout.flush();
+                    continue;
+                }
             }
             else if (type == "preset") {
                 std::string preset_name;
@@ -244,7 +236,7 @@ void uci_loop() {
                 iss >> preset_name;
 
                 if (try_get_default_position(preset_name, fen)) {
-                    board = Board(fen);
+                    board.set_fen(fen);
                     std::cout << "info string loaded preset " << preset_name << "\n";
                     std::cout << "info string fen " << fen << "\n";
                     std::cout.flush();
@@ -330,7 +322,7 @@ void uci_loop() {
                     perft_depth = 1;
                 }
 
-                run_perft(board, perft_depth);
+                run_perft(engine, board, perft_depth);
                 continue;
             }
 